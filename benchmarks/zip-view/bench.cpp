@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/sorters/ska_sorter.h>
+#include <cpp-sort/utility/zip_view.h>
+#include "../benchmarking-tools/rdtsc.h"
+
+////////////////////////////////////////////////////////////
+// Compare sorting (key, payload) pairs stored in a structure of
+// arrays through a zip_view with sorting the equivalent array of
+// structures - all the sorters are sequential
+
+// Type of the keys and of the payloads
+using key_type = int;
+using payload_type = double;
+
+struct record
+{
+    key_type key;
+    payload_type payload;
+};
+
+// Projection on the keys which pdq_sorter doesn't recognize as
+// cheap, to measure the cost of losing branchless partitioning
+auto opaque_key = [](const auto& elem) -> decltype(auto) {
+    return std::get<0>(elem);
+};
+
+template<typename Sorter>
+auto sort_records(const std::vector<key_type>& keys, Sorter sorter)
+    -> std::uint64_t
+{
+    std::vector<record> records;
+    records.reserve(keys.size());
+    for (auto key: keys) {
+        records.push_back({ key, static_cast<payload_type>(key) });
+    }
+
+    std::uint64_t start = rdtsc();
+    sorter(records, &record::key);
+    std::uint64_t end = rdtsc();
+    assert(std::is_sorted(records.begin(), records.end(),
+                          [](const record& lhs, const record& rhs) { return lhs.key < rhs.key; }));
+    return end - start;
+}
+
+template<typename Sorter, typename Projection>
+auto sort_columns(const std::vector<key_type>& keys, Sorter sorter, Projection projection)
+    -> std::uint64_t
+{
+    auto key_column = keys;
+    std::vector<payload_type> payload_column(keys.begin(), keys.end());
+    auto view = cppsort::utility::zip(key_column, payload_column);
+
+    std::uint64_t start = rdtsc();
+    sorter(view, projection);
+    std::uint64_t end = rdtsc();
+    assert(std::is_sorted(key_column.begin(), key_column.end()));
+    return end - start;
+}
+
+template<typename Sorter>
+auto bench_sorter(const std::string& sorter_name, Sorter sorter,
+                  const std::vector<key_type>& keys)
+    -> void
+{
+    using namespace std::chrono_literals;
+    using clock_type = std::conditional_t<
+        std::chrono::high_resolution_clock::is_steady,
+        std::chrono::high_resolution_clock,
+        std::chrono::steady_clock
+    >;
+
+    std::pair<std::string, std::uint64_t (*)(const std::vector<key_type>&, Sorter)> layouts[] = {
+        { "records", [](const std::vector<key_type>& keys, Sorter sorter) {
+            return sort_records(keys, sorter);
+        } },
+        { "zip_view-get_column", [](const std::vector<key_type>& keys, Sorter sorter) {
+            return sort_columns(keys, sorter, cppsort::utility::get_column<0>{});
+        } },
+        { "zip_view-lambda", [](const std::vector<key_type>& keys, Sorter sorter) {
+            return sort_columns(keys, sorter, opaque_key);
+        } },
+    };
+
+    for (auto& layout: layouts) {
+        std::vector<std::uint64_t> cycles;
+        auto total_start = clock_type::now();
+        auto total_end = clock_type::now();
+        while (total_end - total_start < 5s) {
+            auto nb_cycles = layout.second(keys, sorter);
+            cycles.push_back(double(nb_cycles) / keys.size() + 0.5);
+            total_end = clock_type::now();
+        }
+
+        for (std::ostream* stream: {&std::cout, &std::cerr}) {
+            (*stream) << keys.size() << ", " << sorter_name << ", " << layout.first << ", ";
+            auto it = cycles.begin();
+            (*stream) << *it;
+            while (++it != cycles.end()) {
+                (*stream) << ", " << *it;
+            }
+            (*stream) << std::endl;
+        }
+    }
+}
+
+int main()
+{
+    std::size_t sizes[] = { 1'000, 100'000, 1'000'000 };
+
+    // Poor seed, yet enough for our benchmarks
+    std::uint_fast32_t seed = std::time(nullptr);
+    std::cerr << "SEED: " << seed << '\n';
+    std::mt19937 engine(seed);
+
+    for (auto size: sizes) {
+        std::uniform_int_distribution<key_type> distribution(0, static_cast<key_type>(size * 100));
+        std::vector<key_type> keys(size);
+        for (auto& key: keys) {
+            key = distribution(engine);
+        }
+
+        bench_sorter("pdq_sort", cppsort::pdq_sort, keys);
+        bench_sorter("merge_sort", cppsort::merge_sort, keys);
+        bench_sorter("ska_sort", cppsort::ska_sort, keys);
+    }
+}
@@ -1,6 +1,6 @@
 # -*- coding: utf-8 -*-
 
-# Copyright (c) 2018-2022 Morwenn
+# Copyright (c) 2018-2023 Morwenn
 # SPDX-License-Identifier: MIT
 
 import os.path
@@ -32,6 +32,8 @@ class CppSortConan(ConanFile):
         "cmake/cpp-sort-config.cmake.in"
     ]
     settings = "os", "compiler", "build_type", "arch"
+    options = {"use_threads": [True, False]}
+    default_options = {"use_threads": False}
     no_copy_source = True
 
     def validate(self):
@@ -44,6 +46,7 @@ class CppSortConan(ConanFile):
     def generate(self):
         tc = CMakeToolchain(self)
         tc.variables["BUILD_TESTING"] = "OFF"
+        tc.variables["CPPSORT_USE_THREADS"] = self.options.use_threads
         tc.generate()
 
     def package(self):
@@ -64,6 +67,8 @@ class CppSortConan(ConanFile):
 
         if is_msvc(self):
             self.cpp_info.cxxflags = ["/permissive-"]
+        if self.options.use_threads and self.settings.get_safe("os") in ["Linux", "FreeBSD"]:
+            self.cpp_info.system_libs = ["pthread"]
 
     def package_id(self):
         self.info.clear()  # Header-only
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2022 Morwenn
+ * Copyright (c) 2015-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_ADAPTERS_H_
@@ -14,9 +14,12 @@
 #include <cpp-sort/adapters/hybrid_adapter.h>
 #include <cpp-sort/adapters/indirect_adapter.h>
 #include <cpp-sort/adapters/out_of_place_adapter.h>
+#include <cpp-sort/adapters/par_adapter.h>
+#include <cpp-sort/adapters/record_adapter.h>
 #include <cpp-sort/adapters/schwartz_adapter.h>
 #include <cpp-sort/adapters/self_sort_adapter.h>
 #include <cpp-sort/adapters/small_array_adapter.h>
+#include <cpp-sort/adapters/small_sort_adapter.h>
 #include <cpp-sort/adapters/split_adapter.h>
 #include <cpp-sort/adapters/stable_adapter.h>
 #include <cpp-sort/adapters/verge_adapter.h>
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022 Morwenn
+ * Copyright (c) 2018-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_ADAPTERS_OUT_OF_PLACE_ADAPTER_H_
@@ -12,9 +12,11 @@
 #include <iterator>
 #include <type_traits>
 #include <utility>
+#include <cpp-sort/fwd.h>
 #include <cpp-sort/sorter_facade.h>
 #include <cpp-sort/sorter_traits.h>
 #include <cpp-sort/utility/adapter_storage.h>
+#include <cpp-sort/utility/buffer.h>
 #include <cpp-sort/utility/size.h>
 #include "../detail/checkers.h"
 #include "../detail/immovable_vector.h"
@@ -29,7 +31,8 @@ namespace cppsort
 
     namespace detail
     {
-        template<typename Sorter, typename ForwardIterator, typename Size, typename... Args>
+        template<typename MemoryProvider, typename Sorter, typename ForwardIterator,
+                 typename Size, typename... Args>
         auto sort_out_of_place(ForwardIterator first, ForwardIterator last,
                                Size size, const Sorter& sorter, Args&&... args)
             -> decltype(auto)
@@ -37,7 +40,7 @@ namespace cppsort
             using rvalue_type = rvalue_type_t<ForwardIterator>;
 
             // Copy the collection into contiguous memory buffer
-            immovable_vector<rvalue_type> buffer(size);
+            immovable_vector<rvalue_type, MemoryProvider> buffer(size);
             buffer.insert_back(first, last);
 
 #ifdef __cpp_lib_uncaught_exceptions
@@ -56,14 +59,52 @@ namespace cppsort
             std::move(buffer.begin(), buffer.end(), first);
 #endif
         }
+
+        // Sort a copy of [first, last) in the destination directly
+        // when the adapted sorter can handle its iterators
+        template<typename MemoryProvider, typename Sorter, typename ForwardIterator,
+                 typename OutputIterator, typename Size, typename... Args>
+        auto sort_copy(ForwardIterator first, ForwardIterator last, OutputIterator result,
+                       Size, std::true_type, const Sorter& sorter, Args&&... args)
+            -> OutputIterator
+        {
+            auto result_last = std::copy(first, last, result);
+            sorter(result, result_last, std::forward<Args>(args)...);
+            return result_last;
+        }
+
+        // Otherwise sort a copy in a contiguous memory buffer, then
+        // move the sorted elements to the destination
+        template<typename MemoryProvider, typename Sorter, typename ForwardIterator,
+                 typename OutputIterator, typename Size, typename... Args>
+        auto sort_copy(ForwardIterator first, ForwardIterator last, OutputIterator result,
+                       Size size, std::false_type, const Sorter& sorter, Args&&... args)
+            -> OutputIterator
+        {
+            immovable_vector<value_type_t<ForwardIterator>, MemoryProvider> buffer(size);
+            for (; first != last ; ++first) {
+                buffer.emplace_back(*first);
+            }
+            sorter(buffer.begin(), buffer.end(), std::forward<Args>(args)...);
+            return std::move(buffer.begin(), buffer.end(), result);
+        }
+
+        template<typename Sorter, typename OutputIterator>
+        using can_sort_in_place = std::is_base_of<
+            iterator_category<Sorter>,
+            iterator_category_t<OutputIterator>
+        >;
+
+        template<typename T>
+        using begin_t = decltype(std::begin(std::declval<T&>()));
     }
 
-    template<typename Sorter>
+    template<typename Sorter, typename MemoryProvider>
     struct out_of_place_adapter:
         utility::adapter_storage<Sorter>,
         detail::check_is_always_stable<Sorter>,
         detail::sorter_facade_fptr<
-            out_of_place_adapter<Sorter>,
+            out_of_place_adapter<Sorter, MemoryProvider>,
             std::is_empty<Sorter>::value
         >
     {
@@ -84,7 +125,8 @@ namespace cppsort
             -> decltype(auto)
         {
             auto size = std::distance(first, last);
-            return detail::sort_out_of_place(first, last, size, this->get(), std::forward<Args>(args)...);
+            return detail::sort_out_of_place<MemoryProvider>(first, last, size, this->get(),
+                                                             std::forward<Args>(args)...);
         }
 
         template<typename Iterable, typename... Args>
@@ -93,8 +135,40 @@ namespace cppsort
         {
             // Might be an optimization for forward/bidirectional iterables
             auto size = utility::size(iterable);
-            return detail::sort_out_of_place(std::begin(iterable), std::end(iterable), size,
-                                             this->get(), std::forward<Args>(args)...);
+            return detail::sort_out_of_place<MemoryProvider>(std::begin(iterable), std::end(iterable),
+                                                             size, this->get(), std::forward<Args>(args)...);
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Sort a copy of the collection into a destination
+
+        template<typename ForwardIterator, typename OutputIterator, typename... Args>
+        auto sort_copy(ForwardIterator first, ForwardIterator last,
+                       OutputIterator result, Args&&... args) const
+            -> OutputIterator
+        {
+            auto size = std::distance(first, last);
+            return detail::sort_copy<MemoryProvider>(first, last, result, size,
+                                                     detail::can_sort_in_place<Sorter, OutputIterator>{},
+                                                     this->get(), std::forward<Args>(args)...);
+        }
+
+        template<
+            typename Iterable,
+            typename OutputIterator,
+            typename... Args,
+            typename = detail::enable_if_t<
+                detail::is_detected_v<detail::begin_t, Iterable>
+            >
+        >
+        auto sort_copy(Iterable&& iterable, OutputIterator result, Args&&... args) const
+            -> OutputIterator
+        {
+            auto size = utility::size(iterable);
+            return detail::sort_copy<MemoryProvider>(std::begin(iterable), std::end(iterable),
+                                                     result, size,
+                                                     detail::can_sort_in_place<Sorter, OutputIterator>{},
+                                                     this->get(), std::forward<Args>(args)...);
         }
 
         ////////////////////////////////////////////////////////////
@@ -106,8 +180,8 @@ namespace cppsort
     ////////////////////////////////////////////////////////////
     // is_stable specialization
 
-    template<typename Sorter, typename... Args>
-    struct is_stable<out_of_place_adapter<Sorter>(Args...)>:
+    template<typename Sorter, typename MemoryProvider, typename... Args>
+    struct is_stable<out_of_place_adapter<Sorter, MemoryProvider>(Args...)>:
         is_stable<Sorter(Args...)>
     {};
 }
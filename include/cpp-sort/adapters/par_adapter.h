@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_ADAPTERS_PAR_ADAPTER_H_
+#define CPPSORT_ADAPTERS_PAR_ADAPTER_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/fwd.h>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/adapter_storage.h>
+#include <cpp-sort/utility/executor.h>
+#include <cpp-sort/utility/functional.h>
+#include "../detail/checkers.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/parallel_merge_sort.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+    ////////////////////////////////////////////////////////////
+    // Adapter
+
+    namespace detail
+    {
+        template<typename Sorter>
+        struct par_adapter_impl:
+            utility::adapter_storage<Sorter>,
+            check_is_always_stable<Sorter>
+        {
+            // Maximal number of threads, 0 meaning as many
+            // threads as the executor can run concurrently
+            std::size_t max_threads = 0;
+            // Executor running the tasks, the default thread
+            // pool when none is given
+            utility::executor_ref executor;
+
+            par_adapter_impl() = default;
+
+            constexpr par_adapter_impl(Sorter&& sorter, utility::executor_ref executor,
+                                       std::size_t nb_threads):
+                utility::adapter_storage<Sorter>(std::move(sorter)),
+                max_threads(nb_threads),
+                executor(executor)
+            {}
+
+            template<
+                typename RandomAccessIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = detail::enable_if_t<
+                    is_projection_iterator_v<Projection, RandomAccessIterator, Compare>
+                >
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            Compare compare={}, Projection projection={}) const
+                -> void
+            {
+                static_assert(
+                    std::is_base_of<
+                        iterator_category,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "par_adapter requires at least random-access iterators"
+                );
+
+                parallel_merge_sort(std::move(first), std::move(last),
+                                    executor, parallelism(max_threads, executor),
+                                    this->get(), std::move(compare), std::move(projection));
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Sorter traits
+
+            using iterator_category = std::random_access_iterator_tag;
+            using is_parallel = std::true_type;
+        };
+    }
+
+    template<typename Sorter>
+    struct par_adapter:
+        sorter_facade<detail::par_adapter_impl<Sorter>>
+    {
+        ////////////////////////////////////////////////////////////
+        // Construction
+
+        par_adapter() = default;
+
+        constexpr explicit par_adapter(Sorter sorter, std::size_t max_threads=0):
+            sorter_facade<detail::par_adapter_impl<Sorter>>(
+                std::move(sorter), utility::executor_ref(), max_threads
+            )
+        {}
+
+        constexpr par_adapter(Sorter sorter, utility::executor_ref executor,
+                              std::size_t max_threads=0):
+            sorter_facade<detail::par_adapter_impl<Sorter>>(
+                std::move(sorter), executor, max_threads
+            )
+        {}
+    };
+
+    ////////////////////////////////////////////////////////////
+    // is_stable specialization
+
+    template<typename Sorter, typename... Args>
+    struct is_stable<par_adapter<Sorter>(Args...)>:
+        is_stable<Sorter(Args...)>
+    {};
+}
+
+#endif // CPPSORT_ADAPTERS_PAR_ADAPTER_H_
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_ADAPTERS_RECORD_ADAPTER_H_
+#define CPPSORT_ADAPTERS_RECORD_ADAPTER_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/adapter_storage.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/sorted_indices.h>
+#include "../detail/bitops.h"
+#include "../detail/checkers.h"
+#include "../detail/gather_permutation.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/keyed_value.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+    ////////////////////////////////////////////////////////////
+    // Adapter
+
+    namespace detail
+    {
+        // Sorting the records directly moves them O(n log n)
+        // times, while sorting the keys and their indices moves
+        // the smaller key/index elements as many times, then
+        // every record twice to apply the permutation
+        template<typename Record, typename SortedElement>
+        constexpr auto should_sort_keys(std::size_t size) noexcept
+            -> bool
+        {
+            if (size < 32) {
+                return false;
+            }
+            auto log_size = detail::log2(size);
+            return sizeof(Record) * (log_size - 2) > sizeof(SortedElement) * log_size;
+        }
+
+        template<typename Sorter>
+        struct record_adapter_impl:
+            utility::adapter_storage<Sorter>,
+            check_is_always_stable<Sorter>
+        {
+            record_adapter_impl() = default;
+
+            constexpr explicit record_adapter_impl(Sorter&& sorter):
+                utility::adapter_storage<Sorter>(std::move(sorter))
+            {}
+
+            template<
+                typename RandomAccessIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = detail::enable_if_t<
+                    is_projection_iterator_v<Projection, RandomAccessIterator, Compare>
+                >
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            Compare compare={}, Projection projection={}) const
+                -> void
+            {
+                static_assert(
+                    std::is_base_of<
+                        iterator_category,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "record_adapter requires at least random-access iterators"
+                );
+
+                // Narrow indices are cheaper to sort
+                auto size = last - first;
+                if (static_cast<std::uintmax_t>(size) <= (std::numeric_limits<std::uint32_t>::max)()) {
+                    sort_records<std::uint32_t>(std::move(first), std::move(last),
+                                                std::move(compare), std::move(projection));
+                } else {
+                    sort_records<std::size_t>(std::move(first), std::move(last),
+                                              std::move(compare), std::move(projection));
+                }
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Sorter traits
+
+            using iterator_category = std::random_access_iterator_tag;
+
+        private:
+
+            template<typename Index, typename RandomAccessIterator,
+                     typename Compare, typename Projection>
+            auto sort_records(RandomAccessIterator first, RandomAccessIterator last,
+                              Compare compare, Projection projection) const
+                -> void
+            {
+                // Arithmetic keys are sorted along with their index
+                // by sorted_indices, other keys are read through
+                // the indices
+                using key_type = projected_t<RandomAccessIterator, Projection>;
+                using sorted_type = conditional_t<
+                    std::is_arithmetic<key_type>::value,
+                    keyed_value<key_type, Index>,
+                    Index
+                >;
+
+                auto size = static_cast<std::size_t>(last - first);
+                if (not should_sort_keys<value_type_t<RandomAccessIterator>, sorted_type>(size)) {
+                    this->get()(std::move(first), std::move(last),
+                                std::move(compare), std::move(projection));
+                    return;
+                }
+
+                std::vector<Index> indices(size);
+                utility::sorted_indices<Sorter, Index>(this->get())
+                    .into(first, last, indices.begin(), std::move(compare), std::move(projection));
+                gather_permutation(std::move(first), std::move(last), indices.begin());
+            }
+        };
+    }
+
+    template<typename Sorter>
+    struct record_adapter:
+        sorter_facade<detail::record_adapter_impl<Sorter>>
+    {
+        record_adapter() = default;
+
+        constexpr explicit record_adapter(Sorter sorter):
+            sorter_facade<detail::record_adapter_impl<Sorter>>(std::move(sorter))
+        {}
+    };
+
+    ////////////////////////////////////////////////////////////
+    // is_stable specialization
+
+    template<typename Sorter, typename... Args>
+    struct is_stable<record_adapter<Sorter>(Args...)>:
+        is_stable<Sorter(Args...)>
+    {};
+}
+
+#endif // CPPSORT_ADAPTERS_RECORD_ADAPTER_H_
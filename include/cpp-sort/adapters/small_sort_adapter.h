@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_ADAPTERS_SMALL_SORT_ADAPTER_H_
+#define CPPSORT_ADAPTERS_SMALL_SORT_ADAPTER_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/adapter_storage.h>
+#include <cpp-sort/utility/functional.h>
+#include "../detail/iterator_traits.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+    ////////////////////////////////////////////////////////////
+    // Adapter
+
+    namespace detail
+    {
+        ////////////////////////////////////////////////////////////
+        // Jump table mapping a runtime size to the corresponding
+        // fixed-size sorter: sizes that don't appear in Indices
+        // are mapped to a null pointer
+
+        template<
+            template<std::size_t> class FixedSizeSorter,
+            std::size_t N,
+            typename RandomAccessIterator,
+            typename Compare,
+            typename Projection
+        >
+        auto small_sort_fixed(RandomAccessIterator first, RandomAccessIterator last,
+                              Compare compare, Projection projection)
+            -> void
+        {
+            FixedSizeSorter<N>{}(std::move(first), std::move(last),
+                                 std::move(compare), std::move(projection));
+        }
+
+        template<
+            template<std::size_t> class FixedSizeSorter,
+            std::size_t N,
+            typename RandomAccessIterator,
+            typename Compare,
+            typename Projection
+        >
+        constexpr auto small_sort_entry(std::true_type) noexcept
+            -> void(*)(RandomAccessIterator, RandomAccessIterator, Compare, Projection)
+        {
+            return &small_sort_fixed<FixedSizeSorter, N, RandomAccessIterator, Compare, Projection>;
+        }
+
+        template<
+            template<std::size_t> class FixedSizeSorter,
+            std::size_t N,
+            typename RandomAccessIterator,
+            typename Compare,
+            typename Projection
+        >
+        constexpr auto small_sort_entry(std::false_type) noexcept
+            -> void(*)(RandomAccessIterator, RandomAccessIterator, Compare, Projection)
+        {
+            return nullptr;
+        }
+
+        template<
+            template<std::size_t> class FixedSizeSorter,
+            typename Indices,
+            typename Sizes
+        >
+        struct small_sort_table;
+
+        template<
+            template<std::size_t> class FixedSizeSorter,
+            std::size_t... Indices,
+            std::size_t... Sizes
+        >
+        struct small_sort_table<
+            FixedSizeSorter,
+            std::index_sequence<Indices...>,
+            std::index_sequence<Sizes...>
+        >
+        {
+            template<typename RandomAccessIterator, typename Compare, typename Projection>
+            static auto get(std::size_t size) noexcept
+                -> void(*)(RandomAccessIterator, RandomAccessIterator, Compare, Projection)
+            {
+                using fixed_sort_t = void(*)(RandomAccessIterator, RandomAccessIterator,
+                                             Compare, Projection);
+                static constexpr fixed_sort_t table[] = {
+                    small_sort_entry<FixedSizeSorter, Sizes, RandomAccessIterator, Compare, Projection>(
+                        std::integral_constant<bool, is_in_pack<Sizes, Indices...>>{}
+                    )...
+                };
+                return size < sizeof...(Sizes) ? table[size] : nullptr;
+            }
+        };
+
+        template<
+            template<std::size_t> class FixedSizeSorter,
+            typename Sorter,
+            std::size_t... Indices
+        >
+        struct small_sort_adapter_impl:
+            utility::adapter_storage<Sorter>
+        {
+            small_sort_adapter_impl() = default;
+
+            constexpr explicit small_sort_adapter_impl(Sorter&& sorter):
+                utility::adapter_storage<Sorter>(std::move(sorter))
+            {}
+
+            template<
+                typename RandomAccessIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = detail::enable_if_t<
+                    is_projection_iterator_v<Projection, RandomAccessIterator, Compare>
+                >
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            Compare compare={}, Projection projection={}) const
+                -> void
+            {
+                static_assert(
+                    std::is_base_of<
+                        iterator_category,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "small_sort_adapter requires at least random-access iterators"
+                );
+
+                using table = small_sort_table<
+                    FixedSizeSorter,
+                    std::index_sequence<Indices...>,
+                    std::make_index_sequence<max_in_pack<Indices...>() + 1>
+                >;
+
+                auto size = static_cast<std::size_t>(last - first);
+                auto fixed_sort = table::template get<RandomAccessIterator, Compare, Projection>(size);
+                if (fixed_sort != nullptr) {
+                    fixed_sort(std::move(first), std::move(last),
+                               std::move(compare), std::move(projection));
+                } else {
+                    this->get()(std::move(first), std::move(last),
+                                std::move(compare), std::move(projection));
+                }
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Sorter traits
+
+            using iterator_category = std::random_access_iterator_tag;
+            using is_always_stable = std::false_type;
+        };
+    }
+
+    template<
+        template<std::size_t> class FixedSizeSorter,
+        typename Sorter,
+        typename Indices = typename detail::has_domain<
+            fixed_sorter_traits<FixedSizeSorter>
+        >::domain
+    >
+    struct small_sort_adapter
+    {
+        static_assert(
+            std::is_void<Indices>::value && false,
+            "small_sort_adapter requires the sizes to dispatch to as an std::index_sequence"
+        );
+    };
+
+    template<
+        template<std::size_t> class FixedSizeSorter,
+        typename Sorter,
+        std::size_t... Indices
+    >
+    struct small_sort_adapter<FixedSizeSorter, Sorter, std::index_sequence<Indices...>>:
+        sorter_facade<detail::small_sort_adapter_impl<FixedSizeSorter, Sorter, Indices...>>
+    {
+        small_sort_adapter() = default;
+
+        constexpr explicit small_sort_adapter(Sorter sorter):
+            sorter_facade<detail::small_sort_adapter_impl<FixedSizeSorter, Sorter, Indices...>>(
+                std::move(sorter)
+            )
+        {}
+    };
+}
+
+#endif // CPPSORT_ADAPTERS_SMALL_SORT_ADAPTER_H_
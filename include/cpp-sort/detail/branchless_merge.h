@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_BRANCHLESS_MERGE_H_
+#define CPPSORT_DETAIL_BRANCHLESS_MERGE_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <iterator>
+#include <type_traits>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/branchless_traits.h>
+#include <cpp-sort/utility/iter_move.h>
+#include "config.h"
+#include "iterator_traits.h"
+#include "type_traits.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Whether the merge of two random-access ranges can pick
+    // the next element to move with a conditional move instead
+    // of a branch: the comparison and projections have to be
+    // cheap, and the elements have to be cheap to move
+
+    template<
+        typename RandomAccessIterator1,
+        typename RandomAccessIterator2,
+        typename Compare,
+        typename Projection1,
+        typename Projection2
+    >
+    struct can_merge_branchless:
+        std::integral_constant<bool,
+            std::is_base_of<
+                std::random_access_iterator_tag,
+                iterator_category_t<RandomAccessIterator1>
+            >::value &&
+            std::is_base_of<
+                std::random_access_iterator_tag,
+                iterator_category_t<RandomAccessIterator2>
+            >::value &&
+            std::is_same<
+                value_type_t<RandomAccessIterator1>,
+                value_type_t<RandomAccessIterator2>
+            >::value &&
+            std::is_trivially_copyable<value_type_t<RandomAccessIterator1>>::value &&
+            utility::is_probably_branchless_comparison_v<
+                Compare,
+                projected_t<RandomAccessIterator1, Projection1>
+            > &&
+            utility::is_probably_branchless_projection_v<
+                Projection1,
+                value_type_t<RandomAccessIterator1>
+            > &&
+            utility::is_probably_branchless_projection_v<
+                Projection2,
+                value_type_t<RandomAccessIterator2>
+            >
+        >
+    {};
+
+    ////////////////////////////////////////////////////////////
+    // Merge exactly n elements from two sorted ranges without
+    // checking whether either of them is exhausted: the caller
+    // is responsible for ensuring that neither range is read
+    // past its end. Both iterators are advanced without branches
+    // depending on the result of the comparison. Returns the
+    // position of the output iterator
+
+    template<
+        typename RandomAccessIterator1,
+        typename RandomAccessIterator2,
+        typename OutputIterator,
+        typename Size,
+        typename Compare,
+        typename Projection1,
+        typename Projection2
+    >
+    auto branchless_merge_n(RandomAccessIterator1& first1, RandomAccessIterator2& first2,
+                            OutputIterator result, Size n, Compare compare,
+                            Projection1 projection1, Projection2 projection2)
+        -> OutputIterator
+    {
+        using utility::iter_move;
+        auto&& comp = utility::as_function(compare);
+        auto&& proj1 = utility::as_function(projection1);
+        auto&& proj2 = utility::as_function(projection2);
+
+        // Work on local copies to make it easier for the compiler
+        // to keep the iterators in registers
+        auto it1 = first1;
+        auto it2 = first2;
+        for (; n != 0 ; --n) {
+            bool take_second = comp(proj2(*it2), proj1(*it1));
+            *result = take_second ? iter_move(it2) : iter_move(it1);
+            it1 += not take_second;
+            it2 += take_second;
+            ++result;
+        }
+        first1 = it1;
+        first2 = it2;
+        return result;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Merge n elements from the front of two sorted ranges and
+    // n elements from their back at the same time, which gives
+    // two independent dependency chains to the processor. The
+    // caller is responsible for ensuring that 2 * n is not
+    // greater than the size of either range, in which case the
+    // front and back merges can never read the same element.
+    //
+    // Ties are resolved in favour of the first range at the
+    // front and of the second range at the back, which keeps
+    // the merge stable. The output must not overlap the input
+    // ranges
+
+    template<
+        typename RandomAccessIterator1,
+        typename RandomAccessIterator2,
+        typename OutputIterator,
+        typename Size,
+        typename Compare,
+        typename Projection1,
+        typename Projection2
+    >
+    auto branchless_bidirectional_merge_n(RandomAccessIterator1& first1, RandomAccessIterator1& last1,
+                                          RandomAccessIterator2& first2, RandomAccessIterator2& last2,
+                                          OutputIterator& result, OutputIterator& result_last,
+                                          Size n, Compare compare,
+                                          Projection1 projection1, Projection2 projection2)
+        -> void
+    {
+        using utility::iter_move;
+        auto&& comp = utility::as_function(compare);
+        auto&& proj1 = utility::as_function(projection1);
+        auto&& proj2 = utility::as_function(projection2);
+
+        auto front1 = first1;
+        auto front2 = first2;
+        auto back1 = last1 - 1;
+        auto back2 = last2 - 1;
+        auto front_out = result;
+        auto back_out = result_last;
+        for (; n != 0 ; --n) {
+            bool take_front2 = comp(proj2(*front2), proj1(*front1));
+            *front_out = take_front2 ? iter_move(front2) : iter_move(front1);
+            front1 += not take_front2;
+            front2 += take_front2;
+            ++front_out;
+
+            bool take_back1 = comp(proj2(*back2), proj1(*back1));
+            --back_out;
+            *back_out = take_back1 ? iter_move(back1) : iter_move(back2);
+            back1 -= take_back1;
+            back2 -= not take_back1;
+        }
+        first1 = front1;
+        first2 = front2;
+        last1 = back1 + 1;
+        last2 = back2 + 1;
+        result = front_out;
+        result_last = back_out;
+    }
+}}
+
+#endif // CPPSORT_DETAIL_BRANCHLESS_MERGE_H_
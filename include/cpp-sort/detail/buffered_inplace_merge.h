@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2021 Morwenn
+ * Copyright (c) 2015-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 
@@ -19,10 +19,12 @@
 ////////////////////////////////////////////////////////////
 #include <iterator>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <cpp-sort/comparators/flip.h>
 #include <cpp-sort/utility/as_function.h>
 #include <cpp-sort/utility/iter_move.h>
+#include "branchless_merge.h"
 #include "config.h"
 #include "iterator_traits.h"
 #include "memory.h"
@@ -39,11 +41,12 @@ namespace detail
     template<typename InputIterator1, typename InputIterator2,
              typename OutputIterator, typename Size,
              typename Compare, typename Projection>
-    auto half_inplace_merge(InputIterator1 first1, InputIterator1 last1,
-                            InputIterator2 first2, InputIterator2 last2,
-                            OutputIterator result, Size min_len,
-                            Compare compare, Projection projection)
-        -> void
+    auto half_inplace_merge_n(InputIterator1& first1, InputIterator1 last1,
+                              InputIterator2& first2, InputIterator2 last2,
+                              OutputIterator result, Size min_len,
+                              Compare compare, Projection projection,
+                              std::false_type /* branchless */)
+        -> OutputIterator
     {
         using utility::iter_move;
         auto&& comp = utility::as_function(compare);
@@ -61,6 +64,45 @@ namespace detail
             }
             ++result;
         }
+        return result;
+    }
+
+    template<typename RandomAccessIterator1, typename RandomAccessIterator2,
+             typename OutputIterator, typename Size,
+             typename Compare, typename Projection>
+    auto half_inplace_merge_n(RandomAccessIterator1& first1, RandomAccessIterator1,
+                              RandomAccessIterator2& first2, RandomAccessIterator2,
+                              OutputIterator result, Size min_len,
+                              Compare compare, Projection projection,
+                              std::true_type /* branchless */)
+        -> OutputIterator
+    {
+        return branchless_merge_n(first1, first2, std::move(result), min_len,
+                                  std::move(compare), projection, projection);
+    }
+
+    template<typename InputIterator1, typename InputIterator2,
+             typename OutputIterator, typename Size,
+             typename Compare, typename Projection>
+    auto half_inplace_merge(InputIterator1 first1, InputIterator1 last1,
+                            InputIterator2 first2, InputIterator2 last2,
+                            OutputIterator result, Size min_len,
+                            Compare compare, Projection projection)
+        -> void
+    {
+        using utility::iter_move;
+        auto&& comp = utility::as_function(compare);
+        auto&& proj = utility::as_function(projection);
+
+        // The first min_len elements can be merged without
+        // checking whether one of the ranges is exhausted
+        using branchless = can_merge_branchless<
+            InputIterator1, InputIterator2,
+            Compare, Projection, Projection
+        >;
+        result = half_inplace_merge_n(first1, last1, first2, last2,
+                                      std::move(result), min_len,
+                                      compare, projection, branchless{});
 
         if (first1 == last1) {
             // first2 through last2 are already in the right spot
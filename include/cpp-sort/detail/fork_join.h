@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_FORK_JOIN_H_
+#define CPPSORT_DETAIL_FORK_JOIN_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Number of threads used by parallel algorithms when no
+    // explicit limit is given
+
+    inline auto default_parallelism() noexcept
+        -> std::size_t
+    {
+        auto nb_threads = std::thread::hardware_concurrency();
+        return nb_threads == 0 ? 1 : nb_threads;
+    }
+
+    template<typename Executor>
+    auto parallelism(std::size_t max_threads, const Executor& executor)
+        -> std::size_t
+    {
+        if (max_threads != 0) {
+            return max_threads;
+        }
+        auto nb_threads = executor.parallelism();
+        return nb_threads == 0 ? 1 : nb_threads;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Call func(i) for every i in [0, nb_tasks) and wait for all
+    // of the calls to finish.
+    //
+    // nb_tasks - 1 jobs are submitted to the executor, then the
+    // calling thread joins them: every job, including the calling
+    // thread, repeatedly claims the next task that wasn't run yet
+    // until there is none left. The calling thread thus runs the
+    // tasks that no job had the occasion to claim, which means
+    // that the executor doesn't have to run the jobs concurrently,
+    // or even to run them at all before the end of the call:
+    // fork_join can't deadlock when called from a task of a busy
+    // or nested executor.
+    //
+    // The jobs share the state of the call, which is kept alive
+    // until the last of them finishes. If any of the calls to
+    // func throws, the first exception caught is rethrown once
+    // every task has finished.
+
+    struct fork_join_state
+    {
+        std::size_t nb_tasks;
+        std::atomic<std::size_t> next_task;
+        std::size_t nb_done;
+        std::exception_ptr exception;
+        std::mutex mutex;
+        std::condition_variable done;
+
+        explicit fork_join_state(std::size_t nb_tasks):
+            nb_tasks(nb_tasks),
+            next_task(0),
+            nb_done(0),
+            exception(nullptr)
+        {}
+
+        template<typename Func>
+        auto run_tasks(Func* func)
+            -> void
+        {
+            for (auto idx = next_task++; idx < nb_tasks; idx = next_task++) {
+                std::exception_ptr task_exception = nullptr;
+                try {
+                    (*func)(idx);
+                } catch (...) {
+                    task_exception = std::current_exception();
+                }
+
+                std::lock_guard<std::mutex> lock(mutex);
+                if (task_exception && not exception) {
+                    exception = task_exception;
+                }
+                if (++nb_done == nb_tasks) {
+                    done.notify_all();
+                }
+            }
+        }
+    };
+
+    template<typename Executor, typename Func>
+    auto fork_join(Executor& executor, std::size_t nb_tasks, Func func)
+        -> void
+    {
+        if (nb_tasks == 0) {
+            return;
+        }
+        if (nb_tasks == 1) {
+            func(std::size_t(0));
+            return;
+        }
+
+        Func* func_ptr = &func;
+        std::shared_ptr<fork_join_state> state;
+        try {
+            state = std::make_shared<fork_join_state>(nb_tasks);
+        } catch (std::bad_alloc&) {
+            // Run every task on the calling thread
+            fork_join_state local_state(nb_tasks);
+            local_state.run_tasks(func_ptr);
+            if (local_state.exception) {
+                std::rethrow_exception(local_state.exception);
+            }
+            return;
+        }
+        for (std::size_t idx = 0; idx < nb_tasks - 1; ++idx) {
+            try {
+                // Jobs that start after every task was claimed
+                // never touch func, which might not exist anymore
+                executor.submit([state, func_ptr] {
+                    state->run_tasks(func_ptr);
+                });
+            } catch (...) {
+                // The executor can't take more jobs, the calling
+                // thread runs what's left
+                break;
+            }
+        }
+        state->run_tasks(func_ptr);
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->done.wait(lock, [&] { return state->nb_done == state->nb_tasks; });
+        if (state->exception) {
+            std::rethrow_exception(state->exception);
+        }
+    }
+}}
+
+#endif // CPPSORT_DETAIL_FORK_JOIN_H_
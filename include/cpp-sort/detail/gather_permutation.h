@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_GATHER_PERMUTATION_H_
+#define CPPSORT_DETAIL_GATHER_PERMUTATION_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+#include <cpp-sort/utility/apply_permutation.h>
+#include <cpp-sort/utility/iter_move.h>
+#include "config.h"
+#include "iterator_traits.h"
+#include "memory.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Reorder a collection so that its element at position i is
+    // the one that was at position indices[i]: the elements are
+    // gathered in that order in a buffer, which reads them in
+    // the order of the indices and writes them sequentially,
+    // then moved back to the collection. Every element is thus
+    // moved exactly twice. The permutation is applied in place
+    // by following its cycles when no buffer can be allocated
+
+    template<typename RandomAccessIterator1, typename RandomAccessIterator2>
+    auto gather_permutation(RandomAccessIterator1 first, RandomAccessIterator1 last,
+                            RandomAccessIterator2 indices)
+        -> void
+    {
+        using utility::iter_move;
+        using difference_type = difference_type_t<RandomAccessIterator1>;
+        using rvalue_type = rvalue_type_t<RandomAccessIterator1>;
+
+        difference_type size = last - first;
+        temporary_buffer<rvalue_type> buffer(size);
+        if (buffer.size() < size) {
+            // apply_permutation consumes the indices
+            std::vector<difference_type> indices_copy(indices, indices + size);
+            utility::apply_permutation(first, last, indices_copy.begin(), indices_copy.end());
+            return;
+        }
+
+        destruct_n<rvalue_type> d(0);
+        std::unique_ptr<rvalue_type, destruct_n<rvalue_type>&> h(buffer.data(), d);
+        auto ptr = buffer.data();
+        for (difference_type idx = 0 ; idx < size ; ++idx) {
+            ::new (ptr) rvalue_type(iter_move(first + indices[idx]));
+            ++d;
+            ++ptr;
+        }
+        std::move(buffer.data(), buffer.data() + size, first);
+    }
+}}
+
+#endif // CPPSORT_DETAIL_GATHER_PERMUTATION_H_
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Morwenn
+ * Copyright (c) 2021-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_DETAIL_IMMOVABLE_VECTOR_H_
@@ -11,6 +11,7 @@
 #include <cstddef>
 #include <new>
 #include <utility>
+#include <cpp-sort/utility/buffer.h>
 #include <cpp-sort/utility/iter_move.h>
 #include "config.h"
 #include "memory.h"
@@ -29,9 +30,10 @@ namespace detail
     // std::vector-like class for immovable types, it is also
     // through the library as a light contiguous collection when
     // the number of elements to allocate is already known at
-    // construction time.
+    // construction time. The memory is obtained from the given
+    // memory provider.
 
-    template<typename T>
+    template<typename T, typename MemoryProvider=utility::heap_memory>
     class immovable_vector
     {
         public:
@@ -48,7 +50,7 @@ namespace detail
             explicit immovable_vector(std::ptrdiff_t n):
                 capacity_(n),
                 memory_(
-                    static_cast<T*>(::operator new(n * sizeof(T)))
+                    static_cast<T*>(MemoryProvider{}.allocate(n * sizeof(T)))
                 ),
                 end_(memory_)
             {}
@@ -62,11 +64,7 @@ namespace detail
                 detail::destroy(memory_, end_);
 
                 // Free the allocated memory
-#ifdef __cpp_sized_deallocation
-                ::operator delete(memory_, capacity_ * sizeof(T));
-#else
-                ::operator delete(memory_);
-#endif
+                MemoryProvider{}.deallocate(memory_, capacity_ * sizeof(T));
             }
 
             ////////////////////////////////////////////////////////////
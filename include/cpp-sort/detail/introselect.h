@@ -14,9 +14,9 @@
 #include <cpp-sort/utility/iter_move.h>
 #include "bitops.h"
 #include "config.h"
-#include "insertion_sort.h"
 #include "iter_sort3.h"
 #include "iterator_traits.h"
+#include "leaf_sort.h"
 #include "partition.h"
 #include "selection_sort.h"
 #include "swap_if.h"
@@ -41,8 +41,9 @@ namespace detail
                     std::bidirectional_iterator_tag)
         -> void
     {
-        insertion_sort(std::move(first), std::move(last),
-                       std::move(compare), std::move(projection));
+        using leaf_sort = leaf_sort_t<BidirectionalIterator, Compare, Projection>;
+        leaf_sort::sort(std::move(first), std::move(last),
+                        std::move(compare), std::move(projection));
     }
 
     template<typename ForwardIterator, typename Compare, typename Projection>
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_IPS2RA_H_
+#define CPPSORT_DETAIL_IPS2RA_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/executor.h>
+#include "bitops.h"
+#include "ips4o.h"
+#include "iterator_traits.h"
+#include "memory.h"
+#include "ska_sort.h"
+#include "type_traits.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Types mapped to an unsigned integer key by ska_sort
+
+    template<typename T>
+    using radix_key_t = decltype(to_unsigned_or_bool(std::declval<T>()));
+
+    template<typename T>
+    using is_ips2ra_sortable = detail::is_unsigned<detected_t<radix_key_t, T>>;
+
+    ////////////////////////////////////////////////////////////
+    // Classify the elements by log2(mask + 1) bits of their key
+    // starting at the given shift
+
+    template<typename Projection>
+    struct ips2ra_classifier
+    {
+        Projection projection;
+        int shift;
+        std::size_t mask;
+
+        template<typename RandomAccessIterator, typename OutputIterator>
+        auto classify_n(RandomAccessIterator first, RandomAccessIterator last,
+                        OutputIterator out)
+            -> void
+        {
+            auto&& proj = utility::as_function(projection);
+            for (; first != last ; ++first) {
+                *out++ = static_cast<std::size_t>(to_unsigned_or_bool(proj(*first)) >> shift) & mask;
+            }
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // In-place parallel radix sort (IPS2Ra), after the algorithm
+    // described by Axtmann, Witt, Ferizovic and Sanders in
+    // "Engineering In-place (Shared-memory) Sorting Algorithms".
+    //
+    // This is the most significant digit radix sort counterpart
+    // of IPS4o: every step of the recursion finds the highest bit
+    // where the keys differ, then distributes the elements into
+    // up to 256 buckets according to the next bits of their keys
+    // with the same in-place block distribution as IPS4o. The
+    // recursion stops once every bit of the keys was used, and
+    // buckets handled by a single thread are sorted with ska_sort.
+    //
+    // The keys are the ones computed by ska_sort for integral
+    // types, floating point types and pointers. The projection is
+    // called concurrently from several threads.
+
+    template<typename RandomAccessIterator, typename Projection>
+    struct ips2ra_context:
+        ips4o_distributor<RandomAccessIterator>
+    {
+        using difference_type = difference_type_t<RandomAccessIterator>;
+        using value_type = value_type_t<RandomAccessIterator>;
+        using key_type = conditional_t<
+            std::is_same<radix_key_t<projected_t<RandomAccessIterator, Projection>>, bool>::value,
+            unsigned char,
+            radix_key_t<projected_t<RandomAccessIterator, Projection>>
+        >;
+
+        Projection projection;
+
+        ips2ra_context(value_type* storage, difference_type slot_size,
+                       utility::executor_ref executor, Projection projection):
+            ips4o_distributor<RandomAccessIterator>(storage, slot_size, executor),
+            projection(std::move(projection))
+        {}
+
+        auto sort(RandomAccessIterator first, difference_type size,
+                  std::size_t thread_first, std::size_t nb_threads)
+            -> void
+        {
+            // The block distribution only pays off when several
+            // threads share the work, ska_sort is faster otherwise
+            nb_threads = (std::min)(
+                nb_threads,
+                static_cast<std::size_t>(size / ips4o_min_chunk_size)
+            );
+            if (nb_threads < 2) {
+                ska_sort(first, first + size, projection);
+                return;
+            }
+            auto&& proj = utility::as_function(projection);
+
+            // Find the bits where the keys differ
+            auto nb_chunks = static_cast<difference_type>(nb_threads);
+            auto chunk_begin = [&](std::size_t idx) {
+                auto chunk = static_cast<difference_type>(idx);
+                return first + (size / nb_chunks * chunk + (std::min)(chunk, difference_type(size % nb_chunks)));
+            };
+            key_type first_key = to_unsigned_or_bool(proj(*first));
+            std::vector<key_type> chunk_diffs(nb_threads);
+            fork_join(this->executor, nb_threads, [&](std::size_t idx) {
+                key_type diff = 0;
+                for (auto it = chunk_begin(idx), end = chunk_begin(idx + 1) ; it != end ; ++it) {
+                    key_type key = to_unsigned_or_bool(proj(*it));
+                    diff |= key ^ first_key;
+                }
+                chunk_diffs[idx] = diff;
+            });
+            key_type diff = 0;
+            for (auto chunk_diff: chunk_diffs) {
+                diff |= chunk_diff;
+            }
+            if (diff == 0) {
+                // All the keys are equal
+                return;
+            }
+
+            std::size_t nb_bits = detail::log2(diff) + 1;
+            std::size_t log_buckets = (std::min)(nb_bits, ips4o_log_buckets<value_type>(size));
+            std::size_t nb_buckets = std::size_t(1) << log_buckets;
+            ips2ra_classifier<Projection> classifier = {
+                projection,
+                static_cast<int>(nb_bits - log_buckets),
+                nb_buckets - 1
+            };
+
+            auto bucket_starts = this->partition(first, size, thread_first, nb_threads,
+                                                 nb_buckets, classifier);
+            if (classifier.shift == 0) {
+                // Every bucket only holds equal keys
+                return;
+            }
+            ips4o_sort_buckets(this->executor, bucket_starts, thread_first, nb_threads,
+                               [&](std::size_t bucket, std::size_t thread, std::size_t nb) {
+                auto count = bucket_starts[bucket + 1] - bucket_starts[bucket];
+                if (count > 1) {
+                    sort(first + bucket_starts[bucket], count, thread, nb);
+                }
+            });
+        }
+    };
+
+    template<typename RandomAccessIterator, typename Projection>
+    auto ips2ra_sort(RandomAccessIterator first, RandomAccessIterator last,
+                     utility::executor_ref, std::size_t,
+                     Projection projection, std::false_type)
+        -> void
+    {
+        ska_sort(std::move(first), std::move(last), std::move(projection));
+    }
+
+    template<typename RandomAccessIterator, typename Projection>
+    auto ips2ra_sort(RandomAccessIterator first, RandomAccessIterator last,
+                     utility::executor_ref executor, std::size_t nb_threads,
+                     Projection projection, std::true_type)
+        -> void
+    {
+        using value_type = value_type_t<RandomAccessIterator>;
+        using context_type = ips2ra_context<RandomAccessIterator, Projection>;
+
+        auto size = last - first;
+        nb_threads = (std::min)(
+            nb_threads,
+            static_cast<std::size_t>(size / ips4o_min_chunk_size)
+        );
+        if (nb_threads < 2) {
+            ska_sort(std::move(first), std::move(last), std::move(projection));
+            return;
+        }
+
+        // Buffers of the biggest distribution step
+        auto slot_size = context_type::slot_size_for(
+            std::size_t(1) << ips4o_log_buckets<value_type>(size)
+        );
+        auto buffer_size = slot_size * static_cast<std::ptrdiff_t>(nb_threads);
+        auto buffer = get_temporary_buffer<value_type>(buffer_size, buffer_size - 1);
+        if (buffer.first == nullptr) {
+            ska_sort(std::move(first), std::move(last), std::move(projection));
+            return;
+        }
+        struct buffer_deleter
+        {
+            std::pair<value_type*, std::ptrdiff_t>& buffer;
+
+            ~buffer_deleter()
+            {
+                return_temporary_buffer(buffer.first, buffer.second);
+            }
+        } deleter = { buffer };
+
+        context_type context(buffer.first, slot_size, executor, std::move(projection));
+        context.sort(std::move(first), size, 0, nb_threads);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Elements are moved around without any chance to restore
+    // the collection if a move throws: collections whose moves
+    // can throw are sorted with ska_sort instead, as well as
+    // collections whose difference_type is too small to ever
+    // give enough elements to two threads
+
+    template<typename RandomAccessIterator, typename Projection>
+    auto ips2ra_sort(RandomAccessIterator first, RandomAccessIterator last,
+                     utility::executor_ref executor, std::size_t nb_threads,
+                     Projection projection)
+        -> void
+    {
+        using difference_type = difference_type_t<RandomAccessIterator>;
+        using value_type = value_type_t<RandomAccessIterator>;
+        using can_distribute = std::integral_constant<bool,
+            std::is_nothrow_move_constructible<value_type>::value &&
+            std::is_nothrow_move_assignable<value_type>::value &&
+            (std::numeric_limits<difference_type>::max() / 2 >= ips4o_min_chunk_size)
+        >;
+        ips2ra_sort(std::move(first), std::move(last), executor, nb_threads,
+                    std::move(projection), can_distribute{});
+    }
+}}
+
+#endif // CPPSORT_DETAIL_IPS2RA_H_
@@ -0,0 +1,599 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_IPS4O_H_
+#define CPPSORT_DETAIL_IPS4O_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/executor.h>
+#include <cpp-sort/utility/iter_move.h>
+#include "bitops.h"
+#include "iterator_traits.h"
+#include "memory.h"
+#include "pdqsort.h"
+#include "sample_sort_classifier.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    // Minimal number of elements handled by a single thread
+    constexpr std::ptrdiff_t ips4o_min_chunk_size = 1 << 15;
+
+    // Number of samples per bucket used to choose the splitters
+    constexpr std::ptrdiff_t ips4o_oversampling = 16;
+
+    // Number of elements in a block, blocks are about 2KB big
+    template<typename T>
+    constexpr auto ips4o_block_size() noexcept
+        -> std::ptrdiff_t
+    {
+        return sizeof(T) < 2048 ? static_cast<std::ptrdiff_t>(2048 / sizeof(T)) : 1;
+    }
+
+    // Collections and buckets at most that big are sorted with pdqsort
+    template<typename T>
+    constexpr auto ips4o_base_case_size() noexcept
+        -> std::ptrdiff_t
+    {
+        return (std::max)(std::ptrdiff_t(1) << 14, 16 * ips4o_block_size<T>());
+    }
+
+    // Between 2 and 256 buckets so that bucket indices fit in a
+    // byte, each of them getting a few blocks worth of elements
+    template<typename T>
+    auto ips4o_log_buckets(std::ptrdiff_t size)
+        -> std::size_t
+    {
+        return (std::max)(std::size_t(1), (std::min)(
+            std::size_t(8),
+            static_cast<std::size_t>(detail::log2(size / (4 * ips4o_block_size<T>())))
+        ));
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Block distribution of IPS4o, shared with other algorithms
+    // that classify elements into at most 256 buckets:
+    // - Local classification: every thread reads its stripe of
+    //   the collection, classifies the elements and moves them to
+    //   a per-thread buffer of one block per bucket. Full buffers
+    //   are written back as blocks to the part of the stripe that
+    //   was already read, and the bucket of every full block is
+    //   recorded.
+    // - Block permutation: the full blocks are gathered at the
+    //   beginning of the collection, then the threads move them
+    //   to the block-aligned area of their bucket, swapping them
+    //   with the blocks they replace. The read and write pointers
+    //   of every bucket are protected by a mutex.
+    // - Cleanup: the elements of the last block of a bucket that
+    //   overlap the next bucket are moved to the beginning of the
+    //   bucket, then the partially filled buffers of every thread
+    //   fill the remaining gaps.
+    //
+    // The classifier is only called during the local
+    // classification, and if it throws the buffered elements are
+    // moved back to the collection before the exception is
+    // propagated, so no element is ever lost. Moving elements
+    // must not throw.
+
+    template<typename RandomAccessIterator>
+    struct ips4o_distributor
+    {
+        using difference_type = difference_type_t<RandomAccessIterator>;
+        using value_type = value_type_t<RandomAccessIterator>;
+
+        static constexpr difference_type block_size = ips4o_block_size<value_type>();
+
+        // For every thread: one buffer per bucket, two swap
+        // buffers and an overflow buffer, each of them one block
+        value_type* storage;
+        difference_type slot_size;
+        // Where the tasks of the threads run
+        utility::executor_ref executor;
+
+        ips4o_distributor(value_type* storage, difference_type slot_size,
+                          utility::executor_ref executor) noexcept:
+            storage(storage),
+            slot_size(slot_size),
+            executor(executor)
+        {}
+
+        static constexpr auto slot_size_for(std::size_t nb_buckets) noexcept
+            -> difference_type
+        {
+            return static_cast<difference_type>(nb_buckets + 3) * block_size;
+        }
+
+        auto thread_buffers(std::size_t thread) const
+            -> value_type*
+        {
+            return storage + static_cast<difference_type>(thread) * slot_size;
+        }
+
+        static auto align(difference_type pos)
+            -> difference_type
+        {
+            return (pos + block_size - 1) / block_size * block_size;
+        }
+
+        // Distribute the elements of [first, first + size) into
+        // nb_buckets buckets with the classify_n function of the
+        // classifier, return where the buckets start followed by
+        // size
+        template<typename Classifier>
+        auto partition(RandomAccessIterator first, difference_type size,
+                       std::size_t thread_first, std::size_t nb_threads,
+                       std::size_t nb_buckets, Classifier& classifier)
+            -> std::vector<difference_type>
+        {
+            using utility::iter_move;
+            constexpr difference_type block = block_size;
+
+            // Stripes start on block boundaries
+            difference_type nb_blocks = size / block;
+            auto nb_stripes = static_cast<difference_type>(nb_threads);
+            auto stripe_begin = [&](std::size_t idx) -> difference_type {
+                if (idx == nb_threads) {
+                    return size;
+                }
+                auto stripe = static_cast<difference_type>(idx);
+                return block * (nb_blocks / nb_stripes * stripe
+                                + (std::min)(stripe, difference_type(nb_blocks % nb_stripes)));
+            };
+
+            // Number of elements in every buffer of every thread,
+            // number of elements of every bucket in every stripe,
+            // end of the full blocks of every stripe and bucket of
+            // every full block
+            std::vector<difference_type> buffer_sizes(nb_threads * nb_buckets);
+            std::vector<difference_type> bucket_sizes(nb_threads * nb_buckets);
+            std::vector<difference_type> stripe_ends(nb_threads);
+            std::vector<unsigned char> block_buckets(static_cast<std::size_t>(nb_blocks));
+            for (std::size_t idx = 0 ; idx < nb_threads ; ++idx) {
+                stripe_ends[idx] = stripe_begin(idx);
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Local classification
+
+            try {
+                fork_join(executor, nb_threads, [&](std::size_t idx) {
+                    auto buffers = thread_buffers(thread_first + idx);
+                    auto sizes = buffer_sizes.data() + idx * nb_buckets;
+                    auto counts = bucket_sizes.data() + idx * nb_buckets;
+                    auto& write = stripe_ends[idx];
+
+                    std::size_t buckets[16];
+                    for (auto read = write, end = stripe_begin(idx + 1) ; read != end ;) {
+                        auto nb_elements = (std::min)(difference_type(end - read), difference_type(16));
+                        classifier.classify_n(first + read, first + read + nb_elements, buckets);
+                        for (difference_type pos = 0 ; pos < nb_elements ; ++pos) {
+                            auto bucket = buckets[pos];
+                            auto buffer = buffers + static_cast<difference_type>(bucket) * block;
+                            if (sizes[bucket] == block) {
+                                // There is always room for a full block
+                                // among the elements already read
+                                std::move(buffer, buffer + block, first + write);
+                                detail::destroy_n(buffer, block);
+                                sizes[bucket] = 0;
+                                block_buckets[static_cast<std::size_t>(write / block)]
+                                    = static_cast<unsigned char>(bucket);
+                                write += block;
+                            }
+                            ::new (buffer + sizes[bucket]) value_type(iter_move(first + read + pos));
+                            ++sizes[bucket];
+                            ++counts[bucket];
+                        }
+                        read += nb_elements;
+                    }
+                });
+            } catch (...) {
+                // The buffered elements of a stripe fill the space
+                // between the end of its full blocks and the first
+                // element that wasn't read
+                for (std::size_t idx = 0 ; idx < nb_threads ; ++idx) {
+                    auto buffers = thread_buffers(thread_first + idx);
+                    auto pos = first + stripe_ends[idx];
+                    for (std::size_t bucket = 0 ; bucket < nb_buckets ; ++bucket) {
+                        auto buffer = buffers + static_cast<difference_type>(bucket) * block;
+                        auto count = buffer_sizes[idx * nb_buckets + bucket];
+                        pos = std::move(buffer, buffer + count, pos);
+                        detail::destroy_n(buffer, count);
+                    }
+                }
+                throw;
+            }
+
+            std::vector<difference_type> bucket_starts(nb_buckets + 1);
+            for (std::size_t bucket = 0 ; bucket < nb_buckets ; ++bucket) {
+                auto count = bucket_starts[bucket];
+                for (std::size_t idx = 0 ; idx < nb_threads ; ++idx) {
+                    count += bucket_sizes[idx * nb_buckets + bucket];
+                }
+                bucket_starts[bucket + 1] = count;
+            }
+
+            // Gather the full blocks at the beginning of the collection
+            difference_type full_end = stripe_ends[0];
+            for (std::size_t idx = 1 ; idx < nb_threads ; ++idx) {
+                auto begin = stripe_begin(idx);
+                if (begin != full_end) {
+                    std::move(first + begin, first + stripe_ends[idx], first + full_end);
+                    std::copy(block_buckets.begin() + begin / block,
+                              block_buckets.begin() + stripe_ends[idx] / block,
+                              block_buckets.begin() + full_end / block);
+                }
+                full_end += stripe_ends[idx] - begin;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Block permutation
+
+            // The blocks of a bucket start at the first block boundary
+            // of the bucket, [writes, reads) holds the blocks not yet
+            // moved in the area of the bucket
+            std::vector<difference_type> writes(nb_buckets);
+            std::vector<difference_type> reads(nb_buckets);
+            for (std::size_t bucket = 0 ; bucket < nb_buckets ; ++bucket) {
+                writes[bucket] = align(bucket_starts[bucket]);
+                reads[bucket] = (std::max)(writes[bucket], (std::min)(
+                    full_end,
+                    align(bucket_starts[bucket + 1])
+                ));
+            }
+            std::vector<std::mutex> locks(nb_buckets);
+
+            // The last block of a bucket can be past the end of the
+            // collection, it is then written to an overflow buffer
+            auto overflow = thread_buffers(thread_first) + static_cast<difference_type>(nb_buckets + 2) * block;
+            std::size_t overflow_bucket = nb_buckets;
+
+            auto move_construct_block = [&](RandomAccessIterator it, value_type* buffer) {
+                for (difference_type pos = 0 ; pos < block ; ++pos) {
+                    ::new (buffer + pos) value_type(iter_move(it + pos));
+                }
+            };
+
+            fork_join(executor, nb_threads, [&](std::size_t idx) {
+                auto buffer = thread_buffers(thread_first + idx) + static_cast<difference_type>(nb_buckets) * block;
+                auto swap_buffer = buffer + block;
+
+                for (std::size_t step = 0 ; step < nb_buckets ; ++step) {
+                    auto bucket = (idx * nb_buckets / nb_threads + step) % nb_buckets;
+                    while (true) {
+                        // Take an unprocessed block out of the bucket
+                        std::size_t dest;
+                        {
+                            std::lock_guard<std::mutex> lock(locks[bucket]);
+                            if (reads[bucket] <= writes[bucket]) {
+                                break;
+                            }
+                            reads[bucket] -= block;
+                            move_construct_block(first + reads[bucket], buffer);
+                            dest = block_buckets[static_cast<std::size_t>(reads[bucket] / block)];
+                        }
+
+                        // Swap it with the blocks it replaces until
+                        // it lands on an empty one
+                        while (true) {
+                            std::lock_guard<std::mutex> lock(locks[dest]);
+                            auto pos = writes[dest];
+                            writes[dest] += block;
+                            if (pos < reads[dest]) {
+                                move_construct_block(first + pos, swap_buffer);
+                                std::move(buffer, buffer + block, first + pos);
+                                detail::destroy_n(buffer, block);
+                                std::swap(buffer, swap_buffer);
+                                auto& pos_bucket = block_buckets[static_cast<std::size_t>(pos / block)];
+                                std::size_t next_dest = pos_bucket;
+                                pos_bucket = static_cast<unsigned char>(dest);
+                                dest = next_dest;
+                            } else {
+                                if (pos + block > size) {
+                                    std::uninitialized_copy(std::make_move_iterator(buffer),
+                                                            std::make_move_iterator(buffer + block),
+                                                            overflow);
+                                    overflow_bucket = dest;
+                                } else {
+                                    std::move(buffer, buffer + block, first + pos);
+                                }
+                                detail::destroy_n(buffer, block);
+                                break;
+                            }
+                        }
+                    }
+                }
+            });
+
+            ////////////////////////////////////////////////////////////
+            // Cleanup
+
+            for (std::size_t bucket = 0 ; bucket < nb_buckets ; ++bucket) {
+                auto begin = bucket_starts[bucket];
+                auto end = bucket_starts[bucket + 1];
+                auto blocks_begin = align(begin);
+                auto blocks_end = writes[bucket];
+
+                // The gaps to fill are [begin, head_end) and [tail_begin, end)
+                auto head_begin = begin;
+                auto head_end = end;
+                auto tail_begin = end;
+                if (blocks_begin != blocks_end) {
+                    head_end = blocks_begin;
+                    if (blocks_end > end) {
+                        // The elements of the last block that overlap
+                        // the next bucket go to the head of this one
+                        auto overlap = blocks_end - end;
+                        if (bucket == overflow_bucket) {
+                            auto pos = blocks_end - block;
+                            std::move(overflow, overflow + (end - pos), first + pos);
+                            std::move(overflow + (end - pos), overflow + block, first + begin);
+                            detail::destroy_n(overflow, block);
+                        } else {
+                            std::move(first + end, first + blocks_end, first + begin);
+                        }
+                        head_begin += overlap;
+                    } else {
+                        tail_begin = blocks_end;
+                    }
+                }
+
+                auto pos = head_begin;
+                for (std::size_t idx = 0 ; idx < nb_threads ; ++idx) {
+                    auto buffer = thread_buffers(thread_first + idx) + static_cast<difference_type>(bucket) * block;
+                    auto count = buffer_sizes[idx * nb_buckets + bucket];
+                    for (difference_type elem = 0 ; elem < count ; ++elem) {
+                        if (pos == head_end) {
+                            pos = tail_begin;
+                        }
+                        first[pos] = std::move(buffer[elem]);
+                        ++pos;
+                    }
+                    detail::destroy_n(buffer, count);
+                }
+            }
+            return bucket_starts;
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Sort the buckets of a distribution step: those big enough
+    // to occupy every thread on their own are sorted one after
+    // the other with all the threads, the other ones are handed
+    // out to the threads one at a time.
+    //
+    // sort_bucket(bucket, thread, nb) sorts a bucket with nb
+    // threads whose buffers start with the ones of thread
+
+    template<typename Difference, typename SortBucket>
+    auto ips4o_sort_buckets(utility::executor_ref executor,
+                            const std::vector<Difference>& bucket_starts,
+                            std::size_t thread_first, std::size_t nb_threads,
+                            SortBucket sort_bucket)
+        -> void
+    {
+        std::size_t nb_buckets = bucket_starts.size() - 1;
+        if (nb_threads == 1) {
+            for (std::size_t bucket = 0 ; bucket < nb_buckets ; ++bucket) {
+                sort_bucket(bucket, thread_first, std::size_t(1));
+            }
+            return;
+        }
+
+        auto size = bucket_starts.back() - bucket_starts.front();
+        auto nb_chunks = static_cast<Difference>(nb_threads);
+        for (std::size_t bucket = 0 ; bucket < nb_buckets ; ++bucket) {
+            auto count = bucket_starts[bucket + 1] - bucket_starts[bucket];
+            if (count * nb_chunks > size) {
+                sort_bucket(bucket, thread_first, nb_threads);
+            }
+        }
+
+        std::atomic<std::size_t> next_bucket(0);
+        fork_join(executor, nb_threads, [&](std::size_t idx) {
+            for (auto bucket = next_bucket++ ; bucket < nb_buckets ; bucket = next_bucket++) {
+                auto count = bucket_starts[bucket + 1] - bucket_starts[bucket];
+                if (count * nb_chunks <= size) {
+                    sort_bucket(bucket, thread_first + idx, std::size_t(1));
+                }
+            }
+        });
+    }
+
+    ////////////////////////////////////////////////////////////
+    // In-place parallel super scalar samplesort (IPS4o), after
+    // the algorithm described by Axtmann, Witt, Ferizovic and
+    // Sanders in "In-place Parallel Super Scalar Samplesort".
+    //
+    // Every step of the recursion chooses splitters among a
+    // sorted random sample, then distributes the elements into
+    // the corresponding buckets in-place with the distributor
+    // above, the elements being classified without branches.
+    // The buckets are then sorted recursively.
+    //
+    // The memory used besides the collection is a few blocks per
+    // bucket and per thread, and the bucket of every full block.
+    // The comparison and the projection are called concurrently
+    // from several threads. Comparisons only happen when sampling
+    // and during the local classification, so no element is lost
+    // if one of them throws.
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    struct ips4o_context:
+        ips4o_distributor<RandomAccessIterator>
+    {
+        using difference_type = difference_type_t<RandomAccessIterator>;
+        using value_type = value_type_t<RandomAccessIterator>;
+        using classifier_type = sample_sort_classifier<const value_type*, Compare, Projection>;
+
+        Compare compare;
+        Projection projection;
+
+        ips4o_context(value_type* storage, difference_type slot_size,
+                      utility::executor_ref executor,
+                      Compare compare, Projection projection):
+            ips4o_distributor<RandomAccessIterator>(storage, slot_size, executor),
+            compare(std::move(compare)),
+            projection(std::move(projection))
+        {}
+
+        auto sort(RandomAccessIterator first, difference_type size,
+                  std::size_t thread_first, std::size_t nb_threads)
+            -> void
+        {
+            if (size <= ips4o_base_case_size<value_type>()) {
+                pdqsort(first, first + size, compare, projection);
+                return;
+            }
+            nb_threads = (std::max)(std::size_t(1), (std::min)(
+                nb_threads,
+                static_cast<std::size_t>(size / ips4o_min_chunk_size)
+            ));
+
+            auto&& comp = utility::as_function(compare);
+            auto&& proj = utility::as_function(projection);
+            std::size_t log_buckets = ips4o_log_buckets<value_type>(size);
+            std::size_t nb_buckets = std::size_t(1) << log_buckets;
+
+            // Choose the splitters among a sorted random sample,
+            // the elements are copied since they move around
+            std::vector<value_type> samples;
+            {
+                auto sample_size = ips4o_oversampling * static_cast<difference_type>(nb_buckets);
+                samples.reserve(static_cast<std::size_t>(sample_size));
+                std::minstd_rand engine(static_cast<std::minstd_rand::result_type>(size));
+                std::uniform_int_distribution<std::ptrdiff_t> dist(0, size - 1);
+                for (difference_type idx = 0 ; idx < sample_size ; ++idx) {
+                    samples.push_back(first[static_cast<difference_type>(dist(engine))]);
+                }
+                pdqsort(samples.begin(), samples.end(), compare, projection);
+            }
+            if (not comp(proj(samples.front()), proj(samples.back()))) {
+                // Most likely a lot of equivalent elements
+                pdqsort(first, first + size, compare, projection);
+                return;
+            }
+            std::vector<const value_type*> splitters;
+            splitters.reserve(nb_buckets - 1);
+            for (std::size_t idx = 1 ; idx < nb_buckets ; ++idx) {
+                splitters.push_back(samples.data() + (idx * ips4o_oversampling - 1));
+            }
+            classifier_type classifier(splitters, log_buckets, compare, projection);
+
+            auto bucket_starts = this->partition(first, size, thread_first, nb_threads,
+                                                 nb_buckets, classifier);
+
+            // A bucket holding more than half of the elements most
+            // likely holds lots of equivalent elements, which is
+            // handled well by pdqsort, this also bounds the depth
+            // of the recursion
+            auto sort_bucket = [&](std::size_t bucket, std::size_t thread, std::size_t nb) {
+                auto begin = first + bucket_starts[bucket];
+                auto count = bucket_starts[bucket + 1] - bucket_starts[bucket];
+                if (count > size / 2) {
+                    pdqsort(begin, begin + count, compare, projection);
+                } else if (count > 1) {
+                    sort(begin, count, thread, nb);
+                }
+            };
+            ips4o_sort_buckets(this->executor, bucket_starts, thread_first, nb_threads, sort_bucket);
+        }
+    };
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    auto ips4o_sort(RandomAccessIterator first, RandomAccessIterator last,
+                    utility::executor_ref, std::size_t,
+                    Compare compare, Projection projection,
+                    std::false_type)
+        -> void
+    {
+        pdqsort(std::move(first), std::move(last), std::move(compare), std::move(projection));
+    }
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    auto ips4o_sort(RandomAccessIterator first, RandomAccessIterator last,
+                    utility::executor_ref executor, std::size_t nb_threads,
+                    Compare compare, Projection projection,
+                    std::true_type)
+        -> void
+    {
+        using value_type = value_type_t<RandomAccessIterator>;
+        using context_type = ips4o_context<RandomAccessIterator, Compare, Projection>;
+
+        auto size = last - first;
+        if (size <= ips4o_base_case_size<value_type>()) {
+            pdqsort(std::move(first), std::move(last), std::move(compare), std::move(projection));
+            return;
+        }
+        nb_threads = (std::max)(std::size_t(1), (std::min)(
+            nb_threads,
+            static_cast<std::size_t>(size / ips4o_min_chunk_size)
+        ));
+
+        // Buffers of the biggest distribution step
+        auto slot_size = context_type::slot_size_for(
+            std::size_t(1) << ips4o_log_buckets<value_type>(size)
+        );
+        auto buffer_size = slot_size * static_cast<std::ptrdiff_t>(nb_threads);
+        auto buffer = get_temporary_buffer<value_type>(buffer_size, buffer_size - 1);
+        if (buffer.first == nullptr) {
+            pdqsort(std::move(first), std::move(last), std::move(compare), std::move(projection));
+            return;
+        }
+        struct buffer_deleter
+        {
+            std::pair<value_type*, std::ptrdiff_t>& buffer;
+
+            ~buffer_deleter()
+            {
+                return_temporary_buffer(buffer.first, buffer.second);
+            }
+        } deleter = { buffer };
+
+        context_type context(buffer.first, slot_size, executor,
+                             std::move(compare), std::move(projection));
+        context.sort(std::move(first), size, 0, nb_threads);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // The splitters are copies of elements, and the elements are
+    // moved around without any chance to restore the collection
+    // if a move throws: collections that don't fulfill these
+    // requirements are sorted with pdqsort instead, as well as
+    // collections whose difference_type is too small to ever
+    // exceed the base case size
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    auto ips4o_sort(RandomAccessIterator first, RandomAccessIterator last,
+                    utility::executor_ref executor, std::size_t nb_threads,
+                    Compare compare, Projection projection)
+        -> void
+    {
+        using difference_type = difference_type_t<RandomAccessIterator>;
+        using value_type = value_type_t<RandomAccessIterator>;
+        using can_distribute = std::integral_constant<bool,
+            std::is_copy_constructible<value_type>::value &&
+            std::is_nothrow_move_constructible<value_type>::value &&
+            std::is_nothrow_move_assignable<value_type>::value &&
+            (std::numeric_limits<difference_type>::max() > ips4o_base_case_size<value_type>())
+        >;
+        ips4o_sort(std::move(first), std::move(last), executor, nb_threads,
+                   std::move(compare), std::move(projection), can_distribute{});
+    }
+}}
+
+#endif // CPPSORT_DETAIL_IPS4O_H_
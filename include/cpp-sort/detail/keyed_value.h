@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_KEYED_VALUE_H_
+#define CPPSORT_DETAIL_KEYED_VALUE_H_
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Projected key of an element stored next to a value that
+    // refers to the element, such as its index or an iterator:
+    // sorting such pairs by key reads contiguous memory instead
+    // of reaching for random elements of the original collection
+
+    template<typename Key, typename Value>
+    struct keyed_value
+    {
+        Key key;
+        Value value;
+    };
+}}
+
+#endif // CPPSORT_DETAIL_KEYED_VALUE_H_
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_LEAF_SORT_H_
+#define CPPSORT_DETAIL_LEAF_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/fixed/sorting_network_sorter.h>
+#include <cpp-sort/utility/functional.h>
+#include "config.h"
+#include "insertion_sort.h"
+#include "iterator_traits.h"
+#include "type_traits.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Sentinel values used to pad small collections up to the
+    // size of a sorting network: such a value compares greater
+    // than or equal to any other value of the same type
+
+    template<typename T>
+    constexpr auto greatest_value(std::true_type /* has_infinity */) noexcept
+        -> T
+    {
+        return std::numeric_limits<T>::infinity();
+    }
+
+    template<typename T>
+    constexpr auto greatest_value(std::false_type /* has_infinity */) noexcept
+        -> T
+    {
+        return (std::numeric_limits<T>::max)();
+    }
+
+    template<typename T>
+    constexpr auto least_value(std::true_type /* has_infinity */) noexcept
+        -> T
+    {
+        return -std::numeric_limits<T>::infinity();
+    }
+
+    template<typename T>
+    constexpr auto least_value(std::false_type /* has_infinity */) noexcept
+        -> T
+    {
+        return std::numeric_limits<T>::lowest();
+    }
+
+    template<typename T>
+    struct greatest_sentinel:
+        std::is_arithmetic<T>
+    {
+        static constexpr auto get() noexcept
+            -> T
+        {
+            using has_infinity = std::integral_constant<bool, std::numeric_limits<T>::has_infinity>;
+            return greatest_value<T>(has_infinity{});
+        }
+    };
+
+    template<typename T>
+    struct least_sentinel:
+        std::is_arithmetic<T>
+    {
+        static constexpr auto get() noexcept
+            -> T
+        {
+            using has_infinity = std::integral_constant<bool, std::numeric_limits<T>::has_infinity>;
+            return least_value<T>(has_infinity{});
+        }
+    };
+
+    template<typename Compare, typename T>
+    struct network_sentinel:
+        std::false_type
+    {};
+
+    template<typename T>
+    struct network_sentinel<std::less<>, T>:
+        greatest_sentinel<T>
+    {};
+
+    template<typename T>
+    struct network_sentinel<std::less<T>, T>:
+        greatest_sentinel<T>
+    {};
+
+    template<typename T>
+    struct network_sentinel<std::greater<>, T>:
+        least_sentinel<T>
+    {};
+
+    template<typename T>
+    struct network_sentinel<std::greater<T>, T>:
+        least_sentinel<T>
+    {};
+
+#ifdef __cpp_lib_ranges
+    template<typename T>
+    struct network_sentinel<std::ranges::less, T>:
+        greatest_sentinel<T>
+    {};
+
+    template<typename T>
+    struct network_sentinel<std::ranges::greater, T>:
+        least_sentinel<T>
+    {};
+#endif
+
+    ////////////////////////////////////////////////////////////
+    // Leaf sorting policies
+    //
+    // Quicksort-like algorithms stop recursing when partitions
+    // are small enough and sort them with a simpler algorithm;
+    // the following policies describe how those leaves are
+    // sorted
+
+    struct insertion_leaf_sort
+    {
+        template<typename BidirectionalIterator, typename Compare, typename Projection>
+        static auto sort(BidirectionalIterator first, BidirectionalIterator last,
+                         Compare compare, Projection projection)
+            -> void
+        {
+            insertion_sort(std::move(first), std::move(last),
+                           std::move(compare), std::move(projection));
+        }
+    };
+
+    struct sorting_network_leaf_sort
+    {
+        // Leaves are copied to a local buffer, padded with sentinel
+        // values up to the next multiple of 8, sorted with a sorting
+        // network of that size, and copied back: always using one
+        // of a few networks avoids the branch mispredictions that
+        // picking the network matching the exact size would incur,
+        // and the local buffer lets the compiler keep values in
+        // registers. Bigger leaves are sorted with insertion sort.
+        static constexpr std::size_t max_size = 32;
+
+        template<std::size_t N, typename RandomAccessIterator, typename Compare, typename Projection>
+        static auto padded_sort(RandomAccessIterator first, RandomAccessIterator last,
+                                Compare compare, Projection projection)
+            -> void
+        {
+            using value_type = value_type_t<RandomAccessIterator>;
+            using sentinel = network_sentinel<Compare, value_type>;
+
+            value_type buffer[N];
+            auto buffer_last = std::copy(first, last, buffer);
+            std::fill(buffer_last, buffer + N, sentinel::get());
+            sorting_network_sorter<N>{}(buffer, buffer + N,
+                                        std::move(compare), std::move(projection));
+            std::copy(buffer, buffer_last, first);
+        }
+
+        template<typename RandomAccessIterator, typename Compare, typename Projection>
+        static auto sort(RandomAccessIterator first, RandomAccessIterator last,
+                         Compare compare, Projection projection)
+            -> void
+        {
+            auto size = last - first;
+            if (size < 2) {
+                return;
+            } else if (size <= 8) {
+                padded_sort<8>(first, last, std::move(compare), std::move(projection));
+            } else if (size <= 16) {
+                padded_sort<16>(first, last, std::move(compare), std::move(projection));
+            } else if (size <= 24) {
+                padded_sort<24>(first, last, std::move(compare), std::move(projection));
+            } else if (size <= 32) {
+                padded_sort<32>(first, last, std::move(compare), std::move(projection));
+            } else {
+                insertion_sort(std::move(first), std::move(last),
+                               std::move(compare), std::move(projection));
+            }
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Default leaf sorting policy: sorting networks are used
+    // when sorting random-access collections of arithmetic
+    // types with a standard comparison, which is when swaps
+    // can be branchless and when a padding value exists
+
+    template<typename Projection>
+    struct is_identity_projection:
+        std::is_same<Projection, utility::identity>
+    {};
+
+#if CPPSORT_STD_IDENTITY_AVAILABLE
+    template<>
+    struct is_identity_projection<std::identity>:
+        std::true_type
+    {};
+#endif
+
+    template<typename Iterator, typename Compare, typename Projection>
+    using leaf_sort_t = conditional_t<
+        std::is_base_of<std::random_access_iterator_tag, iterator_category_t<Iterator>>::value &&
+        is_identity_projection<Projection>::value &&
+        network_sentinel<Compare, value_type_t<Iterator>>::value,
+        sorting_network_leaf_sort,
+        insertion_leaf_sort
+    >;
+}}
+
+#endif // CPPSORT_DETAIL_LEAF_SORT_H_
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022 Morwenn
+ * Copyright (c) 2019-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_DETAIL_MERGE_MOVE_H_
@@ -8,28 +8,35 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
 #include <utility>
 #include <cpp-sort/utility/as_function.h>
 #include <cpp-sort/utility/iter_move.h>
+#include "branchless_merge.h"
 #include "config.h"
 #include "is_sorted_until.h"
+#include "iterator_traits.h"
 #include "move.h"
 
 namespace cppsort
 {
 namespace detail
 {
+    ////////////////////////////////////////////////////////////
+    // Merge two sorted ranges by moving their elements to an
+    // output range which must not overlap them
+
     template<typename InputIterator1, typename InputIterator2, typename OutputIterator,
              typename Compare, typename Projection1, typename Projection2>
     auto merge_move(InputIterator1 first1, InputIterator1 last1,
                     InputIterator2 first2, InputIterator2 last2,
                     OutputIterator result, Compare compare,
-                    Projection1 projection1, Projection2 projection2)
+                    Projection1 projection1, Projection2 projection2,
+                    std::false_type /* branchless */)
         -> OutputIterator
     {
-        CPPSORT_AUDIT(detail::is_sorted(first1, last1, compare, projection1));
-        CPPSORT_AUDIT(detail::is_sorted(first2, last2, compare, projection2));
-
         using utility::iter_move;
         auto&& comp = utility::as_function(compare);
         auto&& proj1 = utility::as_function(projection1);
@@ -63,6 +70,69 @@ namespace detail
             ++result;
         }
     }
+
+    template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator,
+             typename Compare, typename Projection1, typename Projection2>
+    auto merge_move(RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+                    RandomAccessIterator2 first2, RandomAccessIterator2 last2,
+                    OutputIterator result, Compare compare,
+                    Projection1 projection1, Projection2 projection2,
+                    std::true_type /* branchless */)
+        -> OutputIterator
+    {
+        // Merge from both ends at once as long as both ranges
+        // are big enough for it to be safe
+        auto result_end = result + ((last1 - first1) + (last2 - first2));
+        auto result_last = result_end;
+        while (true) {
+            auto size = (std::min)(last1 - first1, last2 - first2) / 2;
+            if (size < 16) {
+                break;
+            }
+            branchless_bidirectional_merge_n(first1, last1, first2, last2,
+                                             result, result_last, size,
+                                             compare, projection1, projection2);
+        }
+
+        // Merge what remains from the front, reading at most
+        // as many elements as there are in the smallest range
+        while (first1 != last1 && first2 != last2) {
+            auto size = (std::min)(last1 - first1, last2 - first2);
+            result = branchless_merge_n(first1, first2, result, size,
+                                        compare, projection1, projection2);
+        }
+        result = detail::move(first1, last1, result);
+        detail::move(first2, last2, result);
+        return result_end;
+    }
+
+    template<typename InputIterator1, typename InputIterator2, typename OutputIterator,
+             typename Compare, typename Projection1, typename Projection2>
+    auto merge_move(InputIterator1 first1, InputIterator1 last1,
+                    InputIterator2 first2, InputIterator2 last2,
+                    OutputIterator result, Compare compare,
+                    Projection1 projection1, Projection2 projection2)
+        -> OutputIterator
+    {
+        CPPSORT_AUDIT(detail::is_sorted(first1, last1, compare, projection1));
+        CPPSORT_AUDIT(detail::is_sorted(first2, last2, compare, projection2));
+
+        using branchless = std::integral_constant<bool,
+            can_merge_branchless<
+                InputIterator1, InputIterator2,
+                Compare, Projection1, Projection2
+            >::value &&
+            std::is_base_of<
+                std::random_access_iterator_tag,
+                iterator_category_t<OutputIterator>
+            >::value
+        >;
+        return merge_move(std::move(first1), std::move(last1),
+                          std::move(first2), std::move(last2),
+                          std::move(result), std::move(compare),
+                          std::move(projection1), std::move(projection2),
+                          branchless{});
+    }
 }}
 
 #endif // CPPSORT_DETAIL_MERGE_MOVE_H_
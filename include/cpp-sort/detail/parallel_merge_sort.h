@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_PARALLEL_MERGE_SORT_H_
+#define CPPSORT_DETAIL_PARALLEL_MERGE_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/executor.h>
+#include <cpp-sort/utility/iter_move.h>
+#include "iterator_traits.h"
+#include "memory.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    // Minimal number of elements sorted by a single task
+    constexpr std::ptrdiff_t parallel_merge_sort_min_chunk_size = 1 << 14;
+
+    ////////////////////////////////////////////////////////////
+    // Multisequence selection
+    //
+    // The elements of several sorted runs are ordered by value
+    // then by run index, which is the order in which a stable
+    // merge outputs them. Given a rank, find how many elements
+    // of every run come before that rank in the merged sequence:
+    // for a run, the position of its first element whose rank
+    // is not smaller is found with a binary search, computing
+    // the rank of an element with a binary search in every run
+
+    template<typename Iterator, typename Difference,
+             typename Compare, typename Projection>
+    auto multiway_split(Iterator first, const Difference* run_starts, std::size_t nb_runs,
+                        Difference rank, Difference* splits,
+                        Compare compare, Projection projection)
+        -> void
+    {
+        auto&& comp = utility::as_function(compare);
+        auto&& proj = utility::as_function(projection);
+
+        for (std::size_t run = 0; run < nb_runs; ++run) {
+            auto run_first = first + run_starts[run];
+            auto run_size = (std::min)(run_starts[run + 1] - run_starts[run], rank);
+
+            // Rank of the element at position pos of the run
+            auto rank_of = [&](Difference pos) {
+                auto&& value = proj(run_first[pos]);
+                Difference res = pos;
+                for (std::size_t other = 0; other < nb_runs; ++other) {
+                    if (other == run) {
+                        continue;
+                    }
+                    auto other_first = first + run_starts[other];
+                    auto other_last = first + run_starts[other + 1];
+                    if (other < run) {
+                        // Equivalent elements of previous runs come first
+                        res += std::partition_point(other_first, other_last, [&](auto&& elem) {
+                            return not comp(value, proj(elem));
+                        }) - other_first;
+                    } else {
+                        res += std::partition_point(other_first, other_last, [&](auto&& elem) {
+                            return comp(proj(elem), value);
+                        }) - other_first;
+                    }
+                }
+                return res;
+            };
+
+            Difference lo = 0;
+            Difference hi = run_size;
+            while (lo < hi) {
+                auto mid = lo + (hi - lo) / 2;
+                if (rank_of(mid) < rank) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            splits[run] = lo;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Merge the sub-runs [first[i], last[i]) of the buffer into
+    // result: a binary heap holds the indices of the runs that
+    // still have elements, the run whose current element comes
+    // first being at the top. Equivalent elements are taken
+    // from the run with the smallest index first, which keeps
+    // the merge stable. heap must have room for nb_runs indices.
+    //
+    // If a comparison throws, the elements that weren't merged
+    // yet are moved to the rest of the output, so that it holds
+    // every element of the runs
+
+    template<typename T, typename RandomAccessIterator,
+             typename Compare, typename Projection>
+    auto multiway_merge_move(T** first, T** last, std::size_t nb_runs,
+                             std::size_t* heap, RandomAccessIterator result,
+                             Compare compare, Projection projection)
+        -> void
+    {
+        auto&& comp = utility::as_function(compare);
+        auto&& proj = utility::as_function(projection);
+
+        // Whether the current element of rhs comes before the
+        // current element of lhs in the merged sequence
+        auto comes_after = [&](std::size_t lhs, std::size_t rhs) {
+            if (rhs < lhs) {
+                return not comp(proj(*first[lhs]), proj(*first[rhs]));
+            }
+            return comp(proj(*first[rhs]), proj(*first[lhs]));
+        };
+
+        try {
+            auto heap_end = heap;
+            for (std::size_t run = 0; run < nb_runs; ++run) {
+                if (first[run] != last[run]) {
+                    *heap_end++ = run;
+                }
+            }
+            std::make_heap(heap, heap_end, comes_after);
+            while (heap_end != heap) {
+                std::pop_heap(heap, heap_end, comes_after);
+                auto run = heap_end[-1];
+                *result = std::move(*first[run]);
+                ++result;
+                if (++first[run] == last[run]) {
+                    --heap_end;
+                } else {
+                    std::push_heap(heap, heap_end, comes_after);
+                }
+            }
+        } catch (...) {
+            for (std::size_t run = 0; run < nb_runs; ++run) {
+                result = std::move(first[run], last[run], result);
+            }
+            throw;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Parallel merge sort
+    //
+    // The collection is split into one chunk per thread, every
+    // chunk is sorted with the given sorter, then the chunks are
+    // merged in parallel: the merged sequence is split into as
+    // many parts as there are chunks, and every thread finds
+    // which elements of every chunk belong to its part before
+    // merging them with a multiway merge. The chunks are moved
+    // to a buffer beforehand, and merged back into the
+    // collection. The result is stable when the sorter is.
+    //
+    // The collection is sorted with the given sorter directly
+    // when it is too small to be split between several threads,
+    // when the move operations of its elements can throw or
+    // when no buffer big enough can be allocated
+
+    template<typename RandomAccessIterator, typename Sorter,
+             typename Compare, typename Projection>
+    auto parallel_merge_sort(RandomAccessIterator first, RandomAccessIterator last,
+                             utility::executor_ref executor, std::size_t nb_threads,
+                             const Sorter& sorter, Compare compare, Projection projection)
+        -> void
+    {
+        using utility::iter_move;
+        using difference_type = difference_type_t<RandomAccessIterator>;
+        using value_type = value_type_t<RandomAccessIterator>;
+
+        difference_type size = last - first;
+        difference_type nb_chunks = (std::min)(
+            static_cast<difference_type>(nb_threads),
+            size / parallel_merge_sort_min_chunk_size
+        );
+        if (nb_chunks < 2 ||
+            not std::is_nothrow_move_constructible<value_type>::value ||
+            not std::is_nothrow_move_assignable<value_type>::value) {
+            sorter(std::move(first), std::move(last), std::move(compare), std::move(projection));
+            return;
+        }
+
+        // Only a buffer for the whole collection is useful, the
+        // minimal count is exclusive
+        auto buffer = get_temporary_buffer<value_type>(size, size - 1);
+        if (buffer.first == nullptr) {
+            sorter(std::move(first), std::move(last), std::move(compare), std::move(projection));
+            return;
+        }
+        struct buffer_deleter
+        {
+            std::pair<value_type*, std::ptrdiff_t>& buffer;
+            std::ptrdiff_t constructed = 0;
+
+            ~buffer_deleter()
+            {
+                detail::destroy_n(buffer.first, constructed);
+                return_temporary_buffer(buffer.first, buffer.second);
+            }
+        } deleter = { buffer };
+
+        nb_threads = static_cast<std::size_t>(nb_chunks);
+        std::vector<difference_type> chunk_starts(nb_threads + 1);
+        for (std::size_t idx = 0; idx <= nb_threads; ++idx) {
+            auto chunk = static_cast<difference_type>(idx);
+            chunk_starts[idx] = size / nb_chunks * chunk + (std::min)(chunk, size % nb_chunks);
+        }
+
+        // Sort the chunks
+        fork_join(executor, nb_threads, [&](std::size_t idx) {
+            sorter(first + chunk_starts[idx], first + chunk_starts[idx + 1], compare, projection);
+        });
+
+        // Find which elements of every chunk end up in every part
+        // of the merged sequence, the parts having the same
+        // bounds as the chunks
+        std::vector<difference_type> splits((nb_threads + 1) * nb_threads);
+        for (std::size_t run = 0; run < nb_threads; ++run) {
+            splits[nb_threads * nb_threads + run] = chunk_starts[run + 1] - chunk_starts[run];
+        }
+        fork_join(executor, nb_threads - 1, [&](std::size_t idx) {
+            multiway_split(first, chunk_starts.data(), nb_threads, chunk_starts[idx + 1],
+                           splits.data() + (idx + 1) * nb_threads,
+                           compare, projection);
+        });
+
+        // Memory used by the merges, allocated before the elements
+        // are moved to the buffer so that every one of them is
+        // moved back if it can't be allocated
+        std::vector<value_type*> runs_bounds(2 * nb_threads * nb_threads);
+        std::vector<std::size_t> heaps(nb_threads * nb_threads);
+
+        // Move the sorted chunks to the buffer, moves can't throw
+        fork_join(executor, nb_threads, [&](std::size_t idx) {
+            auto ptr = buffer.first + chunk_starts[idx];
+            for (auto pos = chunk_starts[idx]; pos != chunk_starts[idx + 1]; ++pos) {
+                ::new (ptr) value_type(iter_move(first + pos));
+                ++ptr;
+            }
+        });
+        deleter.constructed = size;
+
+        // Merge every part back into the collection
+        fork_join(executor, nb_threads, [&](std::size_t idx) {
+            auto runs_first = runs_bounds.data() + 2 * idx * nb_threads;
+            auto runs_last = runs_first + nb_threads;
+            for (std::size_t run = 0; run < nb_threads; ++run) {
+                auto run_first = buffer.first + chunk_starts[run];
+                runs_first[run] = run_first + splits[idx * nb_threads + run];
+                runs_last[run] = run_first + splits[(idx + 1) * nb_threads + run];
+            }
+            multiway_merge_move(runs_first, runs_last, nb_threads,
+                                heaps.data() + idx * nb_threads,
+                                first + chunk_starts[idx], compare, projection);
+        });
+    }
+}}
+
+#endif // CPPSORT_DETAIL_PARALLEL_MERGE_SORT_H_
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_PARALLEL_SAMPLE_SORT_H_
+#define CPPSORT_DETAIL_PARALLEL_SAMPLE_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/utility/executor.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/iter_move.h>
+#include "bitops.h"
+#include "iterator_traits.h"
+#include "memory.h"
+#include "pdqsort.h"
+#include "sample_sort_classifier.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    // Minimal number of elements handled by a single thread
+    constexpr std::ptrdiff_t parallel_sample_sort_min_chunk_size = 1 << 14;
+
+    // Number of samples per bucket used to choose the splitters
+    constexpr std::ptrdiff_t parallel_sample_sort_oversampling = 16;
+
+    ////////////////////////////////////////////////////////////
+    // Parallel stable sample sort
+    //
+    // The splitters are chosen among a sorted random sample of
+    // the collection, then every thread classifies the elements
+    // of its chunk of the collection into buckets and counts
+    // them. The per-thread counts give every thread its own
+    // write position in every bucket, which keeps the elements
+    // of a bucket in their original order when they are moved
+    // to a buffer. The buckets are then sorted in parallel with
+    // the given stable sorter and moved back.
+    //
+    // Elements equivalent to a splitter all end up in the same
+    // bucket, so collections with few distinct values get less
+    // parallelism out of the bucket sorting phase.
+    //
+    // The collection is sorted with the given sorter directly
+    // when it is too small to be split between several threads,
+    // when its elements can't be moved without throwing or when
+    // no buffer big enough can be allocated
+
+    template<typename RandomAccessIterator, typename Sorter,
+             typename Compare, typename Projection>
+    auto parallel_sample_sort(RandomAccessIterator first, RandomAccessIterator last,
+                              utility::executor_ref executor, std::size_t nb_threads,
+                              const Sorter& sorter,
+                              Compare compare, Projection projection)
+        -> void
+    {
+        using utility::iter_move;
+        using difference_type = difference_type_t<RandomAccessIterator>;
+        using value_type = value_type_t<RandomAccessIterator>;
+
+        difference_type size = last - first;
+        difference_type nb_chunks = (std::min)(
+            static_cast<difference_type>(nb_threads),
+            static_cast<difference_type>(size / parallel_sample_sort_min_chunk_size)
+        );
+        if (nb_chunks < 2 || not std::is_nothrow_move_constructible<value_type>::value) {
+            sorter(std::move(first), std::move(last), std::move(compare), std::move(projection));
+            return;
+        }
+
+        auto buffer = get_temporary_buffer<value_type>(size, size - 1);
+        if (buffer.first == nullptr) {
+            sorter(std::move(first), std::move(last), std::move(compare), std::move(projection));
+            return;
+        }
+        struct buffer_deleter
+        {
+            std::pair<value_type*, std::ptrdiff_t>& buffer;
+            std::ptrdiff_t constructed = 0;
+
+            ~buffer_deleter()
+            {
+                detail::destroy_n(buffer.first, constructed);
+                return_temporary_buffer(buffer.first, buffer.second);
+            }
+        } deleter = { buffer };
+
+        nb_threads = static_cast<std::size_t>(nb_chunks);
+        auto chunk_begin = [&](std::size_t idx) {
+            auto chunk = static_cast<difference_type>(idx);
+            return size / nb_chunks * chunk + (std::min)(chunk, difference_type(size % nb_chunks));
+        };
+
+        // Between 2 and 256 buckets so that bucket indices fit in a byte
+        std::size_t log_buckets = (std::max)(std::size_t(1), (std::min)(
+            std::size_t(8),
+            static_cast<std::size_t>(detail::log2(size / 4096))
+        ));
+        std::size_t nb_buckets = std::size_t(1) << log_buckets;
+
+        // Choose the splitters among a sorted random sample
+        std::vector<RandomAccessIterator> samples;
+        {
+            auto sample_size = parallel_sample_sort_oversampling * static_cast<difference_type>(nb_buckets);
+            samples.reserve(static_cast<std::size_t>(sample_size));
+            std::minstd_rand engine(static_cast<std::minstd_rand::result_type>(size));
+            std::uniform_int_distribution<std::ptrdiff_t> dist(0, size - 1);
+            for (difference_type idx = 0 ; idx < sample_size ; ++idx) {
+                samples.push_back(first + static_cast<difference_type>(dist(engine)));
+            }
+            pdqsort(samples.begin(), samples.end(), compare, utility::indirect{} | projection);
+        }
+        std::vector<RandomAccessIterator> splitters;
+        splitters.reserve(nb_buckets - 1);
+        for (std::size_t idx = 1 ; idx < nb_buckets ; ++idx) {
+            splitters.push_back(samples[idx * parallel_sample_sort_oversampling - 1]);
+        }
+        sample_sort_classifier<RandomAccessIterator, Compare, Projection> classifier(
+            splitters, log_buckets, compare, projection
+        );
+
+        // Classify the elements and count them
+        std::vector<unsigned char> buckets(static_cast<std::size_t>(size));
+        std::vector<difference_type> positions(nb_threads * nb_buckets);
+        fork_join(executor, nb_threads, [&](std::size_t idx) {
+            auto begin = chunk_begin(idx);
+            auto end = chunk_begin(idx + 1);
+            classifier.classify_n(first + begin, first + end, buckets.begin() + begin);
+            auto bucket_sizes = positions.data() + idx * nb_buckets;
+            for (auto pos = begin ; pos != end ; ++pos) {
+                ++bucket_sizes[buckets[static_cast<std::size_t>(pos)]];
+            }
+        });
+
+        // Turn the counts into the position where each chunk
+        // starts writing in each bucket
+        std::vector<difference_type> bucket_starts(nb_buckets + 1);
+        difference_type write_pos = 0;
+        for (std::size_t bucket = 0 ; bucket < nb_buckets ; ++bucket) {
+            bucket_starts[bucket] = write_pos;
+            for (std::size_t idx = 0 ; idx < nb_threads ; ++idx) {
+                auto count = positions[idx * nb_buckets + bucket];
+                positions[idx * nb_buckets + bucket] = write_pos;
+                write_pos += count;
+            }
+        }
+        bucket_starts[nb_buckets] = size;
+
+        // Move the elements to their bucket, moves can't throw
+        fork_join(executor, nb_threads, [&](std::size_t idx) {
+            auto bucket_positions = positions.data() + idx * nb_buckets;
+            for (auto pos = chunk_begin(idx), end = chunk_begin(idx + 1) ; pos != end ; ++pos) {
+                auto& bucket_pos = bucket_positions[buckets[static_cast<std::size_t>(pos)]];
+                ::new (buffer.first + bucket_pos) value_type(iter_move(first + pos));
+                ++bucket_pos;
+            }
+        });
+        deleter.constructed = size;
+
+        // Sort the buckets, then move them back
+        std::atomic<std::size_t> next_bucket(0);
+        try {
+            fork_join(executor, nb_threads, [&](std::size_t) {
+                for (auto bucket = next_bucket++ ; bucket < nb_buckets ; bucket = next_bucket++) {
+                    auto begin = buffer.first + bucket_starts[bucket];
+                    auto end = buffer.first + bucket_starts[bucket + 1];
+                    if (end - begin > 1) {
+                        sorter(begin, end, compare, projection);
+                    }
+                }
+            });
+        } catch (...) {
+            // The collection only holds moved-from elements: give
+            // it back the buffered ones before they are destroyed
+            std::move(buffer.first, buffer.first + size, first);
+            throw;
+        }
+        fork_join(executor, nb_threads, [&](std::size_t idx) {
+            auto begin = chunk_begin(idx);
+            auto end = chunk_begin(idx + 1);
+            std::move(buffer.first + begin, buffer.first + end, first + begin);
+        });
+    }
+}}
+
+#endif // CPPSORT_DETAIL_PARALLEL_SAMPLE_SORT_H_
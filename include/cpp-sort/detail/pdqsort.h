@@ -32,15 +32,16 @@
 #include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <type_traits>
 #include <utility>
 #include <cpp-sort/utility/as_function.h>
 #include <cpp-sort/utility/branchless_traits.h>
 #include <cpp-sort/utility/iter_move.h>
 #include "bitops.h"
 #include "heapsort.h"
-#include "insertion_sort.h"
 #include "iterator_traits.h"
 #include "iter_sort3.h"
+#include "leaf_sort.h"
 
 #ifdef __MINGW32__
 #   include <cstdint> // std::uintptr_t
@@ -52,7 +53,7 @@ namespace detail
 {
     namespace pdqsort_detail {
         enum {
-            // Partitions below this size are sorted using insertion sort.
+            // Partitions below this size are sorted using the leaf sorting policy.
             insertion_sort_threshold = 24,
 
             // Partitions above this size use Tukey's ninther to select the pivot.
@@ -422,7 +423,7 @@ namespace detail
         }
 
 
-        template<typename RandomAccessIterator, typename Compare, typename Projection>
+        template<typename LeafSort, typename RandomAccessIterator, typename Compare, typename Projection>
         auto pdqsort_loop(RandomAccessIterator begin, RandomAccessIterator end,
                           Compare compare, Projection projection,
                           int bad_allowed, bool leftmost=true)
@@ -445,10 +446,10 @@ namespace detail
             while (true) {
                 difference_type size = end - begin;
 
-                // Insertion sort is faster for small arrays.
+                // Insertion sort or sorting networks are faster for small arrays.
                 if (size < insertion_sort_threshold) {
-                    if (leftmost) {
-                        insertion_sort(begin, end, std::move(compare), std::move(projection));
+                    if (leftmost || not std::is_same<LeafSort, insertion_leaf_sort>::value) {
+                        LeafSort::sort(begin, end, std::move(compare), std::move(projection));
                     } else {
                         unguarded_insertion_sort(begin, end, std::move(compare), std::move(projection));
                     }
@@ -533,7 +534,7 @@ namespace detail
 
                 // Sort the left partition first using recursion and do tail recursion elimination for
                 // the right-hand partition.
-                pdqsort_loop(begin, pivot_pos, compare, projection, bad_allowed, leftmost);
+                pdqsort_loop<LeafSort>(begin, pivot_pos, compare, projection, bad_allowed, leftmost);
                 begin = pivot_pos + 1;
                 leftmost = false;
             }
@@ -548,9 +549,10 @@ namespace detail
         auto size = end - begin;
         if (size < 2) return;
 
-        pdqsort_detail::pdqsort_loop(std::move(begin), std::move(end),
-                                     std::move(compare), std::move(projection),
-                                     detail::log2(size));
+        using leaf_sort = leaf_sort_t<RandomAccessIterator, Compare, Projection>;
+        pdqsort_detail::pdqsort_loop<leaf_sort>(std::move(begin), std::move(end),
+                                                std::move(compare), std::move(projection),
+                                                detail::log2(size));
     }
 }}
 
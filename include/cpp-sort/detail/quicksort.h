@@ -14,9 +14,9 @@
 #include <cpp-sort/utility/iter_move.h>
 #include "bitops.h"
 #include "bubble_sort.h"
-#include "insertion_sort.h"
 #include "introselect.h"
 #include "iterator_traits.h"
+#include "leaf_sort.h"
 #include "partition.h"
 
 namespace cppsort
@@ -49,8 +49,9 @@ namespace detail
         -> bool
     {
         if (size < 42) {
-            insertion_sort(std::move(first), std::move(last),
-                           std::move(compare), std::move(projection));
+            using leaf_sort = leaf_sort_t<BidirectionalIterator, Compare, Projection>;
+            leaf_sort::sort(std::move(first), std::move(last),
+                            std::move(compare), std::move(projection));
             return true;
         }
         return false;
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_SAMPLE_SORT_CLASSIFIER_H_
+#define CPPSORT_DETAIL_SAMPLE_SORT_CLASSIFIER_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <cpp-sort/utility/as_function.h>
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Splitters of a sample sort stored as an implicit binary
+    // search tree: node j has children 2j and 2j+1, and the leaf
+    // reached after log_buckets steps gives the bucket of an
+    // element. Comparing an element to a node and moving to the
+    // next one is done without branches, and classify_n handles
+    // several elements at once to hide the latency of the loads
+
+    template<typename SplitterIterator, typename Compare, typename Projection>
+    struct sample_sort_classifier
+    {
+        std::vector<SplitterIterator> tree;
+        std::size_t log_buckets;
+        Compare compare;
+        Projection projection;
+
+        // Splitters have to be sorted
+        sample_sort_classifier(const std::vector<SplitterIterator>& splitters,
+                               std::size_t log_buckets, Compare compare, Projection projection):
+            tree(std::size_t(1) << log_buckets),
+            log_buckets(log_buckets),
+            compare(std::move(compare)),
+            projection(std::move(projection))
+        {
+            std::size_t nb_buckets = tree.size();
+            for (std::size_t level = 0 ; level < log_buckets ; ++level) {
+                std::size_t first_node = std::size_t(1) << level;
+                std::size_t step = nb_buckets >> level;
+                for (std::size_t node = first_node ; node < 2 * first_node ; ++node) {
+                    tree[node] = splitters[(2 * (node - first_node) + 1) * (step / 2) - 1];
+                }
+            }
+        }
+
+        template<typename Iterator>
+        auto classify(Iterator it)
+            -> std::size_t
+        {
+            auto&& comp = utility::as_function(compare);
+            auto&& proj = utility::as_function(projection);
+
+            std::size_t node = 1;
+            for (std::size_t level = 0 ; level < log_buckets ; ++level) {
+                node = 2 * node + static_cast<std::size_t>(comp(proj(*tree[node]), proj(*it)));
+            }
+            return node - tree.size();
+        }
+
+        // Write the bucket of the elements of [first, last) to out
+        template<typename RandomAccessIterator, typename OutputIterator>
+        auto classify_n(RandomAccessIterator first, RandomAccessIterator last,
+                        OutputIterator out)
+            -> void
+        {
+            auto&& comp = utility::as_function(compare);
+            auto&& proj = utility::as_function(projection);
+
+            for (; last - first >= 4 ; first += 4) {
+                std::size_t node0 = 1, node1 = 1, node2 = 1, node3 = 1;
+                for (std::size_t level = 0 ; level < log_buckets ; ++level) {
+                    node0 = 2 * node0 + static_cast<std::size_t>(comp(proj(*tree[node0]), proj(first[0])));
+                    node1 = 2 * node1 + static_cast<std::size_t>(comp(proj(*tree[node1]), proj(first[1])));
+                    node2 = 2 * node2 + static_cast<std::size_t>(comp(proj(*tree[node2]), proj(first[2])));
+                    node3 = 2 * node3 + static_cast<std::size_t>(comp(proj(*tree[node3]), proj(first[3])));
+                }
+                *out++ = node0 - tree.size();
+                *out++ = node1 - tree.size();
+                *out++ = node2 - tree.size();
+                *out++ = node3 - tree.size();
+            }
+            for (; first != last ; ++first) {
+                *out++ = classify(first);
+            }
+        }
+    };
+}}
+
+#endif // CPPSORT_DETAIL_SAMPLE_SORT_CLASSIFIER_H_
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_SORTING_NETWORK_GENERATED_H_
+#define CPPSORT_DETAIL_SORTING_NETWORK_GENERATED_H_
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Sorting networks for sizes without a dedicated hand-written
+    // specialization are generated at compile time: the first
+    // 2^k inputs (with 2^k < N <= 2^(k+1)) and the remaining
+    // ones are sorted by the best networks available for their
+    // size, then both halves are merged with Batcher's odd-even
+    // merge.
+    //
+    // The merge network is the one for 2^(k+1) inputs pruned of
+    // every CE using an index >= N: it is equivalent to padding
+    // the collection with values greater than every other value,
+    // which never move and never need to be compared.
+    //
+    // Like the hand-written networks, the resulting index pairs
+    // are ordered by layer
+
+    constexpr auto sorting_network_merge_pairs_number(std::size_t half, std::size_t size) noexcept
+        -> std::size_t
+    {
+        std::size_t nb_pairs = 0;
+
+        for (auto k = half; k > 0; k /= 2) {
+            for (auto j = k % half; j + k < size; j += 2 * k) {
+                for (std::size_t i = 0; i < k && i + j + k < size; ++i) {
+                    ++nb_pairs;
+                }
+            }
+        }
+
+        return nb_pairs;
+    }
+
+    template<std::size_t N>
+    struct sorting_network_sorter_impl
+    {
+        private:
+
+            static constexpr std::size_t half = hyperfloor(N - 1);
+
+        public:
+
+            template<
+                typename RandomAccessIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = detail::enable_if_t<is_projection_iterator_v<
+                    Projection, RandomAccessIterator, Compare
+                >>
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator,
+                            Compare compare={}, Projection projection={}) const
+                -> void
+            {
+                using difference_type = difference_type_t<RandomAccessIterator>;
+                static constexpr auto pairs = index_pairs<difference_type>();
+                utility::swap_index_pairs(first, pairs, std::move(compare), std::move(projection));
+            }
+
+            template<typename DifferenceType=std::ptrdiff_t>
+            CPPSORT_ATTRIBUTE_NODISCARD
+            static constexpr auto index_pairs() noexcept
+                -> auto
+            {
+                constexpr auto lower_pairs = sorting_network_sorter_impl<half>
+                    ::template index_pairs<DifferenceType>();
+                constexpr auto upper_pairs = sorting_network_sorter_impl<N - half>
+                    ::template index_pairs<DifferenceType>();
+                constexpr std::size_t nb_pairs = lower_pairs.size() + upper_pairs.size()
+                                               + sorting_network_merge_pairs_number(half, N);
+
+                utility::index_pair<DifferenceType> pairs[nb_pairs] = {};
+                std::size_t current_pair_idx = 0;
+
+                // Sort both halves
+                for (std::size_t idx = 0; idx < lower_pairs.size(); ++idx) {
+                    pairs[current_pair_idx] = lower_pairs[idx];
+                    ++current_pair_idx;
+                }
+                for (std::size_t idx = 0; idx < upper_pairs.size(); ++idx) {
+                    pairs[current_pair_idx] = {
+                        static_cast<DifferenceType>(upper_pairs[idx].first + half),
+                        static_cast<DifferenceType>(upper_pairs[idx].second + half)
+                    };
+                    ++current_pair_idx;
+                }
+
+                // Merge them
+                for (auto k = half; k > 0; k /= 2) {
+                    for (auto j = k % half; j + k < N; j += 2 * k) {
+                        for (std::size_t i = 0; i < k && i + j + k < N; ++i) {
+                            pairs[current_pair_idx] = {
+                                static_cast<DifferenceType>(i + j),
+                                static_cast<DifferenceType>(i + j + k)
+                            };
+                            ++current_pair_idx;
+                        }
+                    }
+                }
+
+                // Group independent CEs together
+                return utility::layered_index_pairs<N>(cppsort::detail::make_array(pairs));
+            }
+    };
+}}
+
+#endif // CPPSORT_DETAIL_SORTING_NETWORK_GENERATED_H_
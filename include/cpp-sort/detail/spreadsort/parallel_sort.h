@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_SPREADSORT_PARALLEL_SORT_H_
+#define CPPSORT_DETAIL_SPREADSORT_PARALLEL_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/executor.h>
+#include <cpp-sort/utility/iter_move.h>
+#include "detail/common.h"
+#include "detail/constants.h"
+#include "float_sort.h"
+#include "integer_sort.h"
+#include "../iterator_traits.h"
+#include "../memcpy_cast.h"
+#include "../memory.h"
+#include "../type_traits.h"
+
+namespace cppsort
+{
+namespace detail
+{
+namespace spreadsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Order-preserving mapping of integral and IEEE 754 floating
+    // point values to unsigned integers: flipping the sign bit
+    // of signed integers, and either the sign bit or every bit
+    // of floating point numbers depending on their sign, gives
+    // unsigned keys that compare like the original values
+
+    template<typename T, typename=void>
+    struct unsigned_key;
+
+    template<typename T>
+    struct unsigned_key<T, cppsort::detail::enable_if_t<std::is_integral<T>::value>>
+    {
+        using type = typename std::make_unsigned<
+            cppsort::detail::conditional_t<
+                std::is_same<T, bool>::value,
+                unsigned char,
+                T
+            >
+        >::type;
+
+        static constexpr type sign_mask = std::is_signed<T>::value ?
+            type(type(1) << (CHAR_BIT * sizeof(type) - 1)) :
+            type(0);
+
+        static constexpr auto get(T value) noexcept
+            -> type
+        {
+            return type(type(value) ^ sign_mask);
+        }
+    };
+
+    template<typename T>
+    struct unsigned_key<T, cppsort::detail::enable_if_t<std::is_floating_point<T>::value>>
+    {
+        using type = cppsort::detail::conditional_t<
+            sizeof(T) == sizeof(std::uint32_t),
+            std::uint32_t,
+            std::uint64_t
+        >;
+
+        static constexpr type sign_mask = type(type(1) << (CHAR_BIT * sizeof(type) - 1));
+
+        static auto get(T value) noexcept
+            -> type
+        {
+            auto bits = cppsort::detail::memcpy_cast<type>(value);
+            return type(bits ^ ((bits & sign_mask) ? type(~type(0)) : sign_mask));
+        }
+    };
+
+    // Minimal number of elements handled by a single thread
+    constexpr std::ptrdiff_t parallel_min_chunk_size = 1 << 16;
+
+    template<typename Difference>
+    auto parallel_chunk_begin(Difference size, Difference nb_chunks, Difference idx)
+        -> Difference
+    {
+        return size / nb_chunks * idx + (std::min)(idx, Difference(size % nb_chunks));
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Parallel spreadsort
+    //
+    // The top-level distribution is done by nb_threads threads:
+    // each thread finds the extremes of the keys in its chunk of
+    // the collection then counts the elements falling in each
+    // bin, and the per-thread counts give every thread its own
+    // write position in every bin. The elements are then either
+    // scattered in parallel to a buffer and moved back, or when
+    // no buffer is available, swapped into place in a single
+    // thread. The bins are finally sorted in parallel: those big
+    // enough to occupy every thread on their own are sorted one
+    // after the other with this algorithm, and the others are
+    // handed out to the threads one at a time and sorted with
+    // the sequential algorithm.
+    //
+    // The projection is called concurrently from several threads
+
+    template<typename RandomAccessIter, typename Projection, typename SequentialSort>
+    auto parallel_spreadsort(RandomAccessIter first, RandomAccessIter last,
+                             utility::executor_ref executor, std::size_t nb_threads,
+                             Projection projection,
+                             SequentialSort sequential_sort)
+        -> void
+    {
+      using utility::iter_move;
+      using utility::iter_swap;
+      using difference_type = cppsort::detail::difference_type_t<RandomAccessIter>;
+      using value_type = cppsort::detail::value_type_t<RandomAccessIter>;
+      using key_traits = unsigned_key<cppsort::detail::projected_t<RandomAccessIter, Projection>>;
+      using key_type = typename key_traits::type;
+      auto&& proj = utility::as_function(projection);
+
+      difference_type size = last - first;
+      difference_type nb_chunks = (std::min)(
+          static_cast<difference_type>(nb_threads),
+          static_cast<difference_type>(size / parallel_min_chunk_size)
+      );
+      if (nb_chunks < 2) {
+        sequential_sort(std::move(first), std::move(last), std::move(projection));
+        return;
+      }
+      nb_threads = static_cast<std::size_t>(nb_chunks);
+
+      auto chunk_first = [&](std::size_t idx) {
+        return first + parallel_chunk_begin(size, nb_chunks, static_cast<difference_type>(idx));
+      };
+
+      //Finding the extremes of every chunk, and whether they are sorted
+      struct chunk_extremes {
+        key_type min;
+        key_type max;
+        bool sorted;
+      };
+      std::vector<chunk_extremes> extremes(nb_threads);
+      cppsort::detail::fork_join(executor, nb_threads, [&](std::size_t idx) {
+        auto current = chunk_first(idx);
+        auto end = chunk_first(idx + 1);
+        key_type prev = key_traits::get(proj(*current));
+        chunk_extremes res = { prev, prev, true };
+        while (++current != end) {
+          key_type key = key_traits::get(proj(*current));
+          res.sorted &= not (key < prev);
+          res.min = (std::min)(res.min, key);
+          res.max = (std::max)(res.max, key);
+          prev = key;
+        }
+        extremes[idx] = res;
+      });
+
+      key_type min = extremes[0].min;
+      key_type max = extremes[0].max;
+      bool sorted = extremes[0].sorted;
+      for (std::size_t idx = 1; idx < nb_threads; ++idx) {
+        // A sorted chunk starts with its minimum and ends with its maximum
+        sorted &= extremes[idx].sorted && not (extremes[idx].min < extremes[idx - 1].max);
+        min = (std::min)(min, extremes[idx].min);
+        max = (std::max)(max, extremes[idx].max);
+      }
+      if (sorted)
+        return;
+
+      unsigned log_range = rough_log_2_size(key_type(max - min));
+      unsigned log_divisor = log_range > max_splits ? log_range - max_splits : 0;
+      std::size_t bin_count = std::size_t(key_type(max - min) >> log_divisor) + 1;
+      auto bin_index = [&](key_type key) {
+        return std::size_t(key_type(key - min) >> log_divisor);
+      };
+
+      //Counting the elements of each bin for every chunk
+      std::vector<difference_type> positions(nb_threads * bin_count);
+      cppsort::detail::fork_join(executor, nb_threads, [&](std::size_t idx) {
+        auto bin_sizes = positions.data() + idx * bin_count;
+        for (auto current = chunk_first(idx), end = chunk_first(idx + 1);
+             current != end; ++current) {
+          ++bin_sizes[bin_index(key_traits::get(proj(*current)))];
+        }
+      });
+
+      //Turning the counts into the position where each chunk
+      //starts writing in each bin
+      std::vector<difference_type> bin_starts(bin_count + 1);
+      difference_type pos = 0;
+      for (std::size_t bin = 0; bin < bin_count; ++bin) {
+        bin_starts[bin] = pos;
+        for (std::size_t idx = 0; idx < nb_threads; ++idx) {
+          auto count = positions[idx * bin_count + bin];
+          positions[idx * bin_count + bin] = pos;
+          pos += count;
+        }
+      }
+      bin_starts[bin_count] = size;
+
+      //Distributing the elements into the bins
+      auto buffer = std::is_trivially_copyable<value_type>::value ?
+          cppsort::detail::get_temporary_buffer<value_type>(size, size - 1) :
+          std::pair<value_type*, std::ptrdiff_t>(nullptr, 0);
+      if (buffer.first != nullptr) {
+        struct buffer_deleter {
+          std::pair<value_type*, std::ptrdiff_t>& buffer;
+          ~buffer_deleter() {
+            cppsort::detail::return_temporary_buffer(buffer.first, buffer.second);
+          }
+        } deleter = { buffer };
+
+        cppsort::detail::fork_join(executor, nb_threads, [&](std::size_t idx) {
+          auto bin_positions = positions.data() + idx * bin_count;
+          for (auto current = chunk_first(idx), end = chunk_first(idx + 1);
+               current != end; ++current) {
+            auto& bin_pos = bin_positions[bin_index(key_traits::get(proj(*current)))];
+            ::new (buffer.first + bin_pos) value_type(iter_move(current));
+            ++bin_pos;
+          }
+        });
+        cppsort::detail::fork_join(executor, nb_threads, [&](std::size_t idx) {
+          auto begin = chunk_first(idx) - first;
+          auto end = chunk_first(idx + 1) - first;
+          std::move(buffer.first + begin, buffer.first + end, first + begin);
+        });
+      } else {
+        //Swapping elements into place when no buffer is available
+        std::vector<RandomAccessIter> heads(bin_count);
+        for (std::size_t bin = 0; bin < bin_count; ++bin) {
+          heads[bin] = first + bin_starts[bin];
+        }
+        for (std::size_t bin = 0; bin < bin_count; ++bin) {
+          auto bin_end = first + bin_starts[bin + 1];
+          while (heads[bin] != bin_end) {
+            auto target = bin_index(key_traits::get(proj(*heads[bin])));
+            if (target == bin) {
+              ++heads[bin];
+            } else {
+              iter_swap(heads[bin], heads[target]);
+              ++heads[target];
+            }
+          }
+        }
+      }
+
+      //Every bin only contains equivalent keys
+      if (!log_divisor)
+        return;
+
+      //Sorting the biggest bins with every thread
+      for (std::size_t bin = 0; bin < bin_count; ++bin) {
+        auto count = bin_starts[bin + 1] - bin_starts[bin];
+        if (count * nb_chunks > size) {
+          parallel_spreadsort(first + bin_starts[bin], first + bin_starts[bin + 1],
+                              executor, nb_threads, projection, sequential_sort);
+        }
+      }
+
+      //Handing out the other bins to the threads
+      std::atomic<std::size_t> next_bin(0);
+      cppsort::detail::fork_join(executor, nb_threads, [&](std::size_t) {
+        for (auto bin = next_bin++; bin < bin_count; bin = next_bin++) {
+          auto count = bin_starts[bin + 1] - bin_starts[bin];
+          if (count >= 2 && count * nb_chunks <= size) {
+            sequential_sort(first + bin_starts[bin], first + bin_starts[bin + 1], projection);
+          }
+        }
+      });
+    }
+}
+
+  ////////////////////////////////////////////////////////////
+  // Parallel versions of integer_sort and float_sort, using
+  // at most nb_threads tasks on the given executor
+
+  template<typename RandomAccessIter, typename Projection>
+  auto parallel_integer_sort(RandomAccessIter first, RandomAccessIter last,
+                             utility::executor_ref executor, std::size_t nb_threads,
+                             Projection projection)
+      -> void
+  {
+    detail::parallel_spreadsort(
+        std::move(first), std::move(last), executor, nb_threads, std::move(projection),
+        [](auto begin, auto end, auto proj) {
+          integer_sort(std::move(begin), std::move(end), std::move(proj));
+        }
+    );
+  }
+
+  template<typename RandomAccessIter, typename Projection>
+  auto parallel_float_sort(RandomAccessIter first, RandomAccessIter last,
+                           utility::executor_ref executor, std::size_t nb_threads,
+                           Projection projection)
+      -> void
+  {
+    detail::parallel_spreadsort(
+        std::move(first), std::move(last), executor, nb_threads, std::move(projection),
+        [](auto begin, auto end, auto proj) {
+          float_sort(std::move(begin), std::move(end), std::move(proj));
+        }
+    );
+  }
+}}}
+
+#endif // CPPSORT_DETAIL_SPREADSORT_PARALLEL_SORT_H_
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2022 Morwenn
+ * Copyright (c) 2015-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_DETAIL_SWAP_IF_H_
@@ -9,10 +9,15 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/branchless_traits.h>
 #include <cpp-sort/utility/functional.h>
 #include <cpp-sort/utility/iter_move.h>
 #include "config.h"
@@ -22,11 +27,69 @@ namespace cppsort
 {
 namespace detail
 {
+    ////////////////////////////////////////////////////////////
+    // Branchless swap of small trivially copyable objects
+    //
+    // The object representations are exchanged one word at a
+    // time with a mask computed from the result of the comparison
+    // instead of with a conditional branch. Handling the words
+    // one by one keeps the operations in general-purpose registers
+    // where compilers otherwise tend to vectorize the blend, with
+    // costly transfers between register files
+
+    template<typename T>
+    using masked_swap_word_t = conditional_t<
+        sizeof(T) % sizeof(std::uint64_t) == 0,
+        std::uint64_t,
+        conditional_t<
+            sizeof(T) % sizeof(std::uint32_t) == 0,
+            std::uint32_t,
+            conditional_t<
+                sizeof(T) % sizeof(std::uint16_t) == 0,
+                std::uint16_t,
+                unsigned char
+            >
+        >
+    >;
+
+    template<typename T>
+    struct is_masked_swappable:
+        std::integral_constant<bool,
+            std::is_trivially_copyable<T>::value &&
+            not std::is_const<T>::value &&
+            not std::is_volatile<T>::value &&
+            sizeof(T) <= 32
+        >
+    {};
+
+    template<typename T>
+    auto masked_swap(T& lhs, T& rhs, bool do_swap) noexcept
+        -> void
+    {
+        using word_type = masked_swap_word_t<T>;
+        constexpr std::size_t nb_words = sizeof(T) / sizeof(word_type);
+
+        auto lhs_bytes = reinterpret_cast<unsigned char*>(std::addressof(lhs));
+        auto rhs_bytes = reinterpret_cast<unsigned char*>(std::addressof(rhs));
+        auto mask = static_cast<word_type>(-static_cast<word_type>(do_swap));
+        for (std::size_t idx = 0; idx < nb_words; ++idx) {
+            word_type lhs_word, rhs_word;
+            std::memcpy(&lhs_word, lhs_bytes + idx * sizeof(word_type), sizeof(word_type));
+            std::memcpy(&rhs_word, rhs_bytes + idx * sizeof(word_type), sizeof(word_type));
+            auto diff = static_cast<word_type>((lhs_word ^ rhs_word) & mask);
+            lhs_word ^= diff;
+            rhs_word ^= diff;
+            std::memcpy(lhs_bytes + idx * sizeof(word_type), &lhs_word, sizeof(word_type));
+            std::memcpy(rhs_bytes + idx * sizeof(word_type), &rhs_word, sizeof(word_type));
+        }
+    }
+
     ////////////////////////////////////////////////////////////
     // swap_if
 
     template<typename T, typename Compare, typename Projection>
-    auto swap_if(T& lhs, T& rhs, Compare compare, Projection projection)
+    auto swap_if_impl(T& lhs, T& rhs, Compare compare, Projection projection,
+                      std::false_type /* is_branchless */)
         -> void
     {
         auto&& comp = utility::as_function(compare);
@@ -38,6 +101,35 @@ namespace detail
         }
     }
 
+    template<typename T, typename Compare, typename Projection>
+    auto swap_if_impl(T& lhs, T& rhs, Compare compare, Projection projection,
+                      std::true_type /* is_branchless */)
+        -> void
+    {
+        auto&& comp = utility::as_function(compare);
+        auto&& proj = utility::as_function(projection);
+
+        bool do_swap = comp(proj(rhs), proj(lhs));
+        masked_swap(lhs, rhs, do_swap);
+    }
+
+    template<typename T, typename Compare, typename Projection>
+    auto swap_if(T& lhs, T& rhs, Compare compare, Projection projection)
+        -> void
+    {
+        // Small trivially copyable objects are swapped without
+        // branching when the comparison is cheap, which notably
+        // makes sorting networks fast for small records sorted
+        // on an arithmetic member
+        using projected_type = remove_cvref_t<invoke_result_t<Projection, T&>>;
+        using is_branchless = std::integral_constant<bool,
+            is_masked_swappable<T>::value &&
+            utility::is_probably_branchless_comparison_v<Compare, projected_type> &&
+            utility::is_probably_branchless_projection_v<Projection, T>
+        >;
+        swap_if_impl(lhs, rhs, std::move(compare), std::move(projection), is_branchless{});
+    }
+
     template<typename T>
     auto swap_if(T& lhs, T& rhs)
         noexcept(noexcept(swap_if(lhs, rhs, std::less<>{}, utility::identity{})))
@@ -59,9 +151,12 @@ namespace detail
     auto swap_if(Float& x, Float& y, std::less<>, utility::identity) noexcept
         -> detail::enable_if_t<std::is_floating_point<Float>::value>
     {
+        // The order of the parameters matters for the operation
+        // to be a proper swap when x and y are equivalent but not
+        // equal, for example -0.0 and 0.0
         Float dx = x;
         x = (std::min)(x, y);
-        y = (std::max)(dx, y);
+        y = (std::max)(y, dx);
     }
 
     template<typename Integer>
@@ -79,7 +174,7 @@ namespace detail
     {
         Float dx = x;
         x = (std::max)(x, y);
-        y = (std::min)(dx, y);
+        y = (std::min)(y, dx);
     }
 
 #if CPPSORT_STD_IDENTITY_AVAILABLE
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2022 Morwenn
+ * Copyright (c) 2015-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_DETAIL_TYPE_TRAITS_H_
@@ -357,6 +357,43 @@ namespace detail
 
     template<std::size_t Value>
     constexpr bool is_in_pack<Value> = false;
+
+    ////////////////////////////////////////////////////////////
+    // max_in_pack: return the biggest std::size_t value in a
+    // std::size_t... parameter pack
+
+    template<std::size_t... Values>
+    constexpr auto max_in_pack() noexcept
+        -> std::size_t
+    {
+        // The leading 0 keeps the array valid for an empty pack
+        std::size_t res = 0;
+        std::size_t arr[] = { 0, Values... };
+        for (std::size_t val: arr) {
+            if (val > res) {
+                res = val;
+            }
+        }
+        return res;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // has_domain: check whether fixed_sorter_traits has a
+    // domain, and alias it or void
+
+    template<typename T, typename=void>
+    struct has_domain:
+        std::false_type
+    {
+        using domain = void;
+    };
+
+    template<typename T>
+    struct has_domain<T, void_t<typename T::domain>>:
+        std::true_type
+    {
+        using domain = typename T::domain;
+    };
 }}
 
 #endif // CPPSORT_DETAIL_TYPE_TRAITS_H_
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_EXECUTION_H_
+#define CPPSORT_EXECUTION_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <type_traits>
+#include <cpp-sort/utility/static_const.h>
+#include "detail/config.h"
+
+namespace cppsort
+{
+namespace execution
+{
+    ////////////////////////////////////////////////////////////
+    // Execution policies
+    //
+    // They mirror the ones of the standard library, which are
+    // not available in C++14, and the parallel ones can limit
+    // the number of threads used by a parallel sorter, 0 meaning
+    // that the limit of the sorter itself is used
+
+    struct sequenced_policy {};
+
+    struct parallel_policy
+    {
+        std::size_t max_threads = 0;
+
+        parallel_policy() = default;
+
+        constexpr explicit parallel_policy(std::size_t nb_threads) noexcept:
+            max_threads(nb_threads)
+        {}
+    };
+
+    struct parallel_unsequenced_policy
+    {
+        std::size_t max_threads = 0;
+
+        parallel_unsequenced_policy() = default;
+
+        constexpr explicit parallel_unsequenced_policy(std::size_t nb_threads) noexcept:
+            max_threads(nb_threads)
+        {}
+    };
+
+    namespace
+    {
+        constexpr auto&& seq = utility::static_const<sequenced_policy>::value;
+        constexpr auto&& par = utility::static_const<parallel_policy>::value;
+        constexpr auto&& par_unseq = utility::static_const<parallel_unsequenced_policy>::value;
+    }
+}
+
+    ////////////////////////////////////////////////////////////
+    // Whether a type is an execution policy: the policies of the
+    // standard library are recognized when the opt-in header
+    // <cpp-sort/std_execution.h> is included, which avoids pulling
+    // <execution> and its parallel backend into every program
+
+    template<typename T>
+    struct is_execution_policy:
+        std::false_type
+    {};
+
+    template<>
+    struct is_execution_policy<execution::sequenced_policy>:
+        std::true_type
+    {};
+
+    template<>
+    struct is_execution_policy<execution::parallel_policy>:
+        std::true_type
+    {};
+
+    template<>
+    struct is_execution_policy<execution::parallel_unsequenced_policy>:
+        std::true_type
+    {};
+
+    template<typename T>
+    constexpr bool is_execution_policy_v = is_execution_policy<T>::value;
+
+    namespace detail
+    {
+        ////////////////////////////////////////////////////////////
+        // Maximal number of threads a parallel sorter should use
+        // under a given policy, 0 meaning its own limit; it is a
+        // class template so that specializations declared after
+        // sorter_facade are still found
+
+        template<typename ExecutionPolicy>
+        struct policy_threads;
+
+        template<>
+        struct policy_threads<execution::sequenced_policy>
+        {
+            static constexpr auto max_threads(execution::sequenced_policy) noexcept
+                -> std::size_t
+            {
+                return 1;
+            }
+        };
+
+        template<>
+        struct policy_threads<execution::parallel_policy>
+        {
+            static constexpr auto max_threads(execution::parallel_policy policy) noexcept
+                -> std::size_t
+            {
+                return policy.max_threads;
+            }
+        };
+
+        template<>
+        struct policy_threads<execution::parallel_unsequenced_policy>
+        {
+            static constexpr auto max_threads(execution::parallel_unsequenced_policy policy) noexcept
+                -> std::size_t
+            {
+                return policy.max_threads;
+            }
+        };
+
+        template<typename ExecutionPolicy>
+        constexpr auto policy_max_threads(const ExecutionPolicy& policy) noexcept
+            -> std::size_t
+        {
+            return policy_threads<ExecutionPolicy>::max_threads(policy);
+        }
+    }
+}
+
+#endif // CPPSORT_EXECUTION_H_
@@ -24,13 +24,7 @@ namespace cppsort
     namespace detail
     {
         template<std::size_t N>
-        struct sorting_network_sorter_impl
-        {
-            static_assert(
-                N && false,
-                "sorting_network_sorter has no specialization for this size of N"
-            );
-        };
+        struct sorting_network_sorter_impl;
 
         template<>
         struct sorting_network_sorter_impl<0>:
@@ -90,6 +84,9 @@ namespace cppsort
 #include <cpp-sort/utility/functional.h>
 #include <cpp-sort/utility/sorting_networks.h>
 #include "../detail/attributes.h"
+#include "../detail/bitops.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/make_array.h"
 #include "../detail/swap_if.h"
 #include "../detail/type_traits.h"
 
@@ -158,4 +155,7 @@ namespace cppsort
 #include "../detail/sorting_network/sort63.h"
 #include "../detail/sorting_network/sort64.h"
 
+// Compile-time generated sorting networks for bigger sizes
+#include "../detail/sorting_network/generated.h"
+
 #endif // CPPSORT_FIXED_SORTING_NETWORK_SORTER_H_
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022 Morwenn
+ * Copyright (c) 2016-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_FWD_H_
@@ -21,6 +21,11 @@ namespace cppsort
     // thing
     //
 
+    namespace utility
+    {
+        struct thread_local_memory;
+    }
+
     ////////////////////////////////////////////////////////////
     // Sorters
 
@@ -88,14 +93,20 @@ namespace cppsort
     struct hybrid_adapter;
     template<typename Sorter>
     struct indirect_adapter;
-    template<typename Sorter>
+    template<typename Sorter, typename MemoryProvider=utility::thread_local_memory>
     struct out_of_place_adapter;
     template<typename Sorter>
+    struct par_adapter;
+    template<typename Sorter>
+    struct record_adapter;
+    template<typename Sorter>
     struct schwartz_adapter;
     template<typename Sorter>
     struct self_sort_adapter;
     template<template<std::size_t> class FixedSizeSorter, typename Indices>
     struct small_array_adapter;
+    template<template<std::size_t> class FixedSizeSorter, typename Sorter, typename Indices>
+    struct small_sort_adapter;
     template<typename Sorter>
     struct split_adapter;
     template<typename Sorter>
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021 Morwenn
+ * Copyright (c) 2016-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_PROBES_H_
@@ -18,8 +18,10 @@
 #include <cpp-sort/probes/mono.h>
 #include <cpp-sort/probes/osc.h>
 #include <cpp-sort/probes/par.h>
+#include <cpp-sort/probes/presortedness_report.h>
 #include <cpp-sort/probes/rem.h>
 #include <cpp-sort/probes/runs.h>
+#include <cpp-sort/probes/sorted_ranks.h>
 #include <cpp-sort/probes/sus.h>
 
 #endif // CPPSORT_PROBES_H_
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022 Morwenn
+ * Copyright (c) 2016-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_PROBES_DIS_H_
@@ -134,7 +134,22 @@ namespace probe
                             std::forward_iterator_tag)
             -> ::cppsort::detail::difference_type_t<ForwardIterator>
         {
-            return inplace_dis_probe_algo(first, last, size, compare, projection);
+            // Run the linear algorithm on the iterators when there is
+            // enough memory to store them, otherwise fall back to the
+            // O(n log n) algorithm which does not need any
+            try {
+                cppsort::detail::immovable_vector<ForwardIterator> iterators(size);
+                for (auto it = first; it != last; ++it) {
+                    iterators.emplace_back(it);
+                }
+                return allocating_dis_probe_algo(iterators.begin(), iterators.end(), size,
+                                                 compare, utility::indirect{} | projection);
+            } catch (std::bad_alloc&) {
+                return inplace_dis_probe_algo(
+                    first, last, size,
+                    std::move(compare), std::move(projection)
+                );
+            }
         }
 
         struct dis_impl
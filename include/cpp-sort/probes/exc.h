@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022 Morwenn
+ * Copyright (c) 2016-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_PROBES_EXC_H_
@@ -12,15 +12,13 @@
 #include <iterator>
 #include <utility>
 #include <vector>
+#include <cpp-sort/probes/sorted_ranks.h>
 #include <cpp-sort/sorter_facade.h>
 #include <cpp-sort/sorter_traits.h>
-#include <cpp-sort/utility/as_function.h>
 #include <cpp-sort/utility/functional.h>
 #include <cpp-sort/utility/size.h>
 #include <cpp-sort/utility/static_const.h>
-#include "../detail/immovable_vector.h"
 #include "../detail/iterator_traits.h"
-#include "../detail/pdqsort.h"
 #include "../detail/type_traits.h"
 
 namespace cppsort
@@ -29,83 +27,72 @@ namespace probe
 {
     namespace detail
     {
-        template<typename ForwardIterator, typename Compare, typename Projection>
-        auto exc_probe_algo(ForwardIterator first, ForwardIterator last,
-                            cppsort::detail::difference_type_t<ForwardIterator> size,
-                            Compare compare, Projection projection)
-            -> ::cppsort::detail::difference_type_t<ForwardIterator>
+        template<typename DifferenceType>
+        auto exc_from_ranks(const sorted_ranks<DifferenceType>& ranks)
+            -> DifferenceType
         {
-            using difference_type = ::cppsort::detail::difference_type_t<ForwardIterator>;
-            auto&& comp = utility::as_function(compare);
-            auto&& proj = utility::as_function(projection);
-
-            if (size < 2) {
-                return 0;
+            const auto& rank = ranks.rank;
+            const auto& rank_end = ranks.rank_end;
+            const auto& order = ranks.order;
+            auto size = static_cast<DifferenceType>(rank.size());
+
+            // Whether the element at a given position is equivalent to
+            // the element that belongs there once sorted, computed once
+            // to avoid random accesses to the ranks in the cycles
+            std::vector<bool> in_place(size);
+            for (DifferenceType pos = 0; pos < size; ++pos) {
+                in_place[pos] = rank[pos] <= pos && pos < rank_end[pos];
             }
 
-            ////////////////////////////////////////////////////////////
-            // Indirectly sort the iterators
-
-            // Copy the iterators in a vector
-            cppsort::detail::immovable_vector<ForwardIterator> iterators(size);
-            for (auto it = first; it != last; ++it) {
-                iterators.emplace_back(it);
-            }
-
-            // Sort the iterators on pointed values
-            cppsort::detail::pdqsort(
-                iterators.begin(), iterators.end(),
-                compare, utility::indirect{} | projection
-            );
-
             ////////////////////////////////////////////////////////////
             // Count the number of cycles
 
-            std::vector<bool> sorted(size, false);
-
-            // Element where the current cycle starts
-            auto start = first;
-
-            difference_type cycles = 0;
-            while (start != last) {
-                // Find the element to put in current's place
-                auto current = start;
-                auto next_pos = std::distance(first, current);
-                auto next = iterators[next_pos];
-                sorted[next_pos] = true;
+            std::vector<bool> visited(size, false);
+            DifferenceType cycles = 0;
+            for (DifferenceType start = 0; start < size; ++start) {
+                if (visited[start]) {
+                    continue;
+                }
 
                 // Process the current cycle
-                if (next != current) {
-                    while (next != start) {
-                        // If an element is in the place of another element that compares
-                        // equivalent, it means that this element was actually already in
-                        // a suitable place, so we count one more cycle as if it was an
-                        // already suitably placed element, this handles collections with
-                        // several elements which compare equivalent
-                        if (not comp(proj(*next), proj(*current)) &&
-                            not comp(proj(*current), proj(*next))) {
-                            ++cycles;
-                        }
-                        // Locate the next element of the cycle
-                        current = next;
-                        auto next_pos = std::distance(first, next);
-                        next = iterators[next_pos];
-                        sorted[next_pos] = true;
+                visited[start] = true;
+                auto current = start;
+                auto next = order[start];
+                while (next != start) {
+                    // If an element is in the place of another element that compares
+                    // equivalent, it means that this element was actually already in
+                    // a suitable place, so we count one more cycle as if it was an
+                    // already suitably placed element, this handles collections with
+                    // several elements which compare equivalent
+                    if (in_place[current]) {
+                        ++cycles;
                     }
+                    // Locate the next element of the cycle
+                    visited[next] = true;
+                    current = next;
+                    next = order[next];
                 }
 
                 ++cycles;
-
-                // Find the next cycle
-                auto&& sorted_it = sorted.begin() + std::distance(first, start);
-                do {
-                    ++start;
-                    ++sorted_it;
-                } while (start != last && *sorted_it);
             }
             return size - cycles;
         }
 
+        template<typename ForwardIterator, typename Compare, typename Projection>
+        auto exc_probe_algo(ForwardIterator first, ForwardIterator last,
+                            cppsort::detail::difference_type_t<ForwardIterator> size,
+                            Compare compare, Projection projection)
+            -> ::cppsort::detail::difference_type_t<ForwardIterator>
+        {
+            if (size < 2) {
+                return 0;
+            }
+
+            auto ranks = sorted_ranks_algo(first, last, size,
+                                           std::move(compare), std::move(projection));
+            return exc_from_ranks(ranks);
+        }
+
         struct exc_impl
         {
             template<
@@ -141,6 +128,13 @@ namespace probe
                                       std::move(compare), std::move(projection));
             }
 
+            template<typename DifferenceType>
+            auto operator()(const sorted_ranks<DifferenceType>& ranks) const
+                -> DifferenceType
+            {
+                return exc_from_ranks(ranks);
+            }
+
             template<typename Integer>
             static constexpr auto max_for_size(Integer n)
                 -> Integer
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022 Morwenn
+ * Copyright (c) 2016-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_PROBES_HAM_H_
@@ -11,15 +11,13 @@
 #include <functional>
 #include <iterator>
 #include <utility>
+#include <cpp-sort/probes/sorted_ranks.h>
 #include <cpp-sort/sorter_facade.h>
 #include <cpp-sort/sorter_traits.h>
-#include <cpp-sort/utility/as_function.h>
 #include <cpp-sort/utility/functional.h>
 #include <cpp-sort/utility/size.h>
 #include <cpp-sort/utility/static_const.h>
-#include "../detail/immovable_vector.h"
 #include "../detail/iterator_traits.h"
-#include "../detail/pdqsort.h"
 #include "../detail/type_traits.h"
 
 namespace cppsort
@@ -28,47 +26,38 @@ namespace probe
 {
     namespace detail
     {
+        template<typename DifferenceType>
+        auto ham_from_ranks(const sorted_ranks<DifferenceType>& ranks)
+            -> DifferenceType
+        {
+            const auto& rank = ranks.rank;
+            const auto& rank_end = ranks.rank_end;
+            auto size = static_cast<DifferenceType>(rank.size());
+
+            // Count the number of values not in place: an element is
+            // in place when its position is in its sorted equal range
+            DifferenceType count = 0;
+            for (DifferenceType pos = 0; pos < size; ++pos) {
+                if (pos < rank[pos] || pos >= rank_end[pos]) {
+                    ++count;
+                }
+            }
+            return count;
+        }
+
         template<typename ForwardIterator, typename Compare, typename Projection>
         auto ham_probe_algo(ForwardIterator first, ForwardIterator last,
                             cppsort::detail::difference_type_t<ForwardIterator> size,
                             Compare compare, Projection projection)
             -> ::cppsort::detail::difference_type_t<ForwardIterator>
         {
-            using difference_type = ::cppsort::detail::difference_type_t<ForwardIterator>;
-            auto&& comp = utility::as_function(compare);
-            auto&& proj = utility::as_function(projection);
-
             if (size < 2) {
                 return 0;
             }
 
-            ////////////////////////////////////////////////////////////
-            // Indirectly sort the iterators
-
-            // Copy the iterators in a vector
-            cppsort::detail::immovable_vector<ForwardIterator> iterators(size);
-            for (auto it = first; it != last; ++it) {
-                iterators.emplace_back(it);
-            }
-
-            // Sort the iterators on pointed values
-            cppsort::detail::pdqsort(
-                iterators.begin(), iterators.end(),
-                compare, utility::indirect{} | projection
-            );
-
-            ////////////////////////////////////////////////////////////
-            // Count the number of values not in place
-
-            difference_type count = 0;
-            for (auto&& it: iterators) {
-                if (comp(proj(*first), proj(*it)) ||
-                    comp(proj(*it), proj(*first))) {
-                    ++count;
-                }
-                ++first;
-            }
-            return count;
+            auto ranks = sorted_ranks_algo(first, last, size,
+                                           std::move(compare), std::move(projection));
+            return ham_from_ranks(ranks);
         }
 
         struct ham_impl
@@ -106,6 +95,13 @@ namespace probe
                                       std::move(compare), std::move(projection));
             }
 
+            template<typename DifferenceType>
+            auto operator()(const sorted_ranks<DifferenceType>& ranks) const
+                -> DifferenceType
+            {
+                return ham_from_ranks(ranks);
+            }
+
             template<typename Integer>
             static constexpr auto max_for_size(Integer n)
                 -> Integer
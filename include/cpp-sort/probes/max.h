@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022 Morwenn
+ * Copyright (c) 2016-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_PROBES_MAX_H_
@@ -12,16 +12,15 @@
 #include <functional>
 #include <iterator>
 #include <utility>
+#include <vector>
+#include <cpp-sort/probes/sorted_ranks.h>
 #include <cpp-sort/sorter_facade.h>
 #include <cpp-sort/sorter_traits.h>
 #include <cpp-sort/utility/as_function.h>
 #include <cpp-sort/utility/functional.h>
 #include <cpp-sort/utility/size.h>
 #include <cpp-sort/utility/static_const.h>
-#include "../detail/equal_range.h"
-#include "../detail/immovable_vector.h"
 #include "../detail/iterator_traits.h"
-#include "../detail/pdqsort.h"
 #include "../detail/type_traits.h"
 
 namespace cppsort
@@ -30,6 +29,47 @@ namespace probe
 {
     namespace detail
     {
+        template<typename DifferenceType>
+        auto max_from_ranks(const sorted_ranks<DifferenceType>& ranks)
+            -> DifferenceType
+        {
+            using difference_type = DifferenceType;
+
+            // Maximum distance between the position of an element and
+            // the closest position of its equal range once sorted
+            difference_type res = 0;
+            auto size = static_cast<difference_type>(ranks.rank.size());
+            for (difference_type pos = 0; pos < size; ++pos) {
+                if (pos < ranks.rank[pos]) {
+                    res = (std::max)(ranks.rank[pos] - pos, res);
+                } else if (pos >= ranks.rank_end[pos]) {
+                    res = (std::max)(pos - ranks.rank_end[pos] + 1, res);
+                }
+            }
+            return res;
+        }
+
+        template<typename DifferenceType>
+        auto max_in_run(const std::vector<DifferenceType>& order,
+                        DifferenceType run_begin, DifferenceType run_end,
+                        DifferenceType first_idx, DifferenceType last_idx)
+            -> DifferenceType
+        {
+            // Maximum distance an element whose sorted position is
+            // in [first_idx, last_idx) has to travel to reach the
+            // closest position of its run [run_begin, run_end)
+            DifferenceType res = 0;
+            for (auto idx = first_idx; idx != last_idx; ++idx) {
+                auto pos = order[idx];
+                if (pos < run_begin) {
+                    res = (std::max)(run_begin - pos, res);
+                } else if (pos >= run_end) {
+                    res = (std::max)(pos - run_end + 1, res);
+                }
+            }
+            return res;
+        }
+
         template<typename ForwardIterator, typename Compare, typename Projection>
         auto max_probe_algo(ForwardIterator first, ForwardIterator last,
                             cppsort::detail::difference_type_t<ForwardIterator> size,
@@ -37,52 +77,30 @@ namespace probe
             -> ::cppsort::detail::difference_type_t<ForwardIterator>
         {
             using difference_type = ::cppsort::detail::difference_type_t<ForwardIterator>;
-            auto&& proj = utility::as_function(projection);
+            using category = cppsort::detail::iterator_category_t<ForwardIterator>;
 
             if (size < 2) {
                 return 0;
             }
 
-            ////////////////////////////////////////////////////////////
-            // Indirectly sort the iterators
-
-            // Copy the iterators in a vector
-            cppsort::detail::immovable_vector<ForwardIterator> iterators(size);
-            for (auto it = first; it != last; ++it) {
-                iterators.emplace_back(it);
-            }
-
-            // Sort the iterators on pointed values
-            cppsort::detail::pdqsort(
-                iterators.begin(), iterators.end(),
-                compare, utility::indirect{} | projection
-            );
-
-            ////////////////////////////////////////////////////////////
-            // Maximum distance an element has to travel in order to
-            // reach its sorted position
+            // Sort the original positions of the elements, then compute
+            // the distance of every element to its run of equivalent
+            // elements: the elements are not compared after the sort
+            std::vector<difference_type> order(size);
+            std::vector<bool> run_starts(size, true);
+            sort_ranks_order(first, last, size, std::move(compare), std::move(projection),
+                             order, run_starts, category{});
 
-            difference_type max_dist = 0;
-            difference_type it_pos = 0;
-            for (auto it = first; it != last; ++it) {
-                // Find the range where *first belongs once sorted
-                auto rng = cppsort::detail::equal_range(
-                    iterators.begin(), iterators.end(), proj(*it),
-                    compare, utility::indirect{} | projection
-                );
-                auto pos_min = rng.first - iterators.begin();
-                auto pos_max = rng.second - iterators.begin();
-
-                // If *first isn't into one of its sorted positions, computed the closest
-                if (it_pos < pos_min) {
-                    max_dist = (std::max)(pos_min - it_pos, max_dist);
-                } else if (it_pos >= pos_max) {
-                    max_dist = (std::max)(it_pos - pos_max + 1, max_dist);
+            difference_type res = 0;
+            for (difference_type run_begin = 0; run_begin != size;) {
+                auto run_end = run_begin + 1;
+                while (run_end != size && not run_starts[run_end]) {
+                    ++run_end;
                 }
-
-                ++it_pos;
+                res = (std::max)(max_in_run(order, run_begin, run_end, run_begin, run_end), res);
+                run_begin = run_end;
             }
-            return max_dist;
+            return res;
         }
 
         struct max_impl
@@ -121,6 +139,13 @@ namespace probe
                                       std::move(compare), std::move(projection));
             }
 
+            template<typename DifferenceType>
+            auto operator()(const sorted_ranks<DifferenceType>& ranks) const
+                -> DifferenceType
+            {
+                return max_from_ranks(ranks);
+            }
+
             template<typename Integer>
             static constexpr auto max_for_size(Integer n)
                 -> Integer
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022 Morwenn
+ * Copyright (c) 2016-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_PROBES_OSC_H_
@@ -21,7 +21,6 @@
 #include <cpp-sort/utility/functional.h>
 #include <cpp-sort/utility/size.h>
 #include <cpp-sort/utility/static_const.h>
-#include "../detail/equal_range.h"
 #include "../detail/immovable_vector.h"
 #include "../detail/iterator_traits.h"
 #include "../detail/pdqsort.h"
@@ -85,18 +84,43 @@ namespace probe
             ////////////////////////////////////////////////////////////
             // Indirectly sort the iterators
 
-            // Copy the iterators in a vector
-            cppsort::detail::immovable_vector<ForwardIterator> iterators(size);
-            for (auto it = first; it != last; ++it) {
-                iterators.emplace_back(it);
+            // Copy the iterators in a vector along with the original
+            // position of the element they point to
+            using iterator_pos = std::pair<ForwardIterator, difference_type>;
+            cppsort::detail::immovable_vector<iterator_pos> iterators(size);
+            {
+                difference_type pos = 0;
+                for (auto it = first; it != last; ++it) {
+                    iterators.emplace_back(it, pos);
+                    ++pos;
+                }
             }
 
             // Sort the iterators on pointed values
             cppsort::detail::pdqsort(
-                iterators.begin(), iterators.end(),
-                compare, utility::indirect{} | projection
+                iterators.begin(), iterators.end(), compare,
+                &iterator_pos::first | utility::indirect{} | projection
             );
 
+            ////////////////////////////////////////////////////////////
+            // Find the run of equivalent elements of every element
+
+            // bounds[pos] holds the bounds of the equal range of the
+            // element originally at position pos in the sorted sequence,
+            // which avoids looking for it with a binary search later
+            std::vector<std::pair<difference_type, difference_type>> bounds(size);
+            for (difference_type run_begin = 0; run_begin != size;) {
+                auto run_end = run_begin + 1;
+                while (run_end != size &&
+                       not comp(proj(*iterators[run_end - 1].first), proj(*iterators[run_end].first))) {
+                    ++run_end;
+                }
+                for (auto idx = run_begin; idx != run_end; ++idx) {
+                    bounds[iterators[idx].second] = { run_begin, run_end };
+                }
+                run_begin = run_end;
+            }
+
             ////////////////////////////////////////////////////////////
             // Compute the oscillation
 
@@ -108,41 +132,21 @@ namespace probe
             // decrement cross[pos_max - 1]. Then compute the prefix sum of
             // cross, the oscillation is the sum of that prefix sum.
 
-            // Note: in the following algorithm, all upper_bound calls are
-            //       performed on the full iterator sequence without taking
-            //       advantage of the information we already have to reduce
-            //       the search space. This is because benchmarks reported
-            //       that reducing the search space made the algorithm up to
-            //       twice as slow. Comments in the code contain the lines
-            //       required to reduce the search space again.
+            // Note: the equal ranges of distinct elements don't overlap,
+            //       so comparing their bounds is enough to compare two
+            //       elements, no further comparison is needed.
 
             std::vector<difference_type> cross(size, 0);
-
-            auto prev_bounds = cppsort::detail::equal_range(
-                iterators.begin(), iterators.end(), proj(*first),
-                compare, utility::indirect{} | projection
-            );
-
-            for (auto prev = first, current = std::next(prev); current != last; ++prev, (void)++current) {
+            for (difference_type pos = 1; pos < size; ++pos) {
+                const auto& prev_bounds = bounds[pos - 1];
+                const auto& current_bounds = bounds[pos];
                 difference_type min_idx, max_idx;
-                if (comp(proj(*prev), proj(*current))) {
-                    auto current_bounds = cppsort::detail::equal_range(
-                        //prev_bounds.second, std::prev(iterators.end()), proj(*current),
-                        iterators.begin(), iterators.end(), proj(*current),
-                        compare, utility::indirect{} | projection
-                    );
-                    min_idx = prev_bounds.second - iterators.begin();
-                    max_idx = current_bounds.first - iterators.begin();
-                    prev_bounds = current_bounds;
-                } else if (comp(proj(*current), proj(*prev))) {
-                    auto current_bounds = cppsort::detail::equal_range(
-                        //iterators.begin(), prev_bounds.first, proj(*current),
-                        iterators.begin(), iterators.end(), proj(*current),
-                        compare, utility::indirect{} | projection
-                    );
-                    min_idx = current_bounds.second - iterators.begin();
-                    max_idx = prev_bounds.first - iterators.begin();
-                    prev_bounds = current_bounds;
+                if (prev_bounds.first < current_bounds.first) {
+                    min_idx = prev_bounds.second;
+                    max_idx = current_bounds.first;
+                } else if (current_bounds.first < prev_bounds.first) {
+                    min_idx = current_bounds.second;
+                    max_idx = prev_bounds.first;
                 } else {
                     // *prev == *current, bounds don't change
                     continue;
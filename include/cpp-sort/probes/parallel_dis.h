@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_PROBES_PARALLEL_DIS_H_
+#define CPPSORT_PROBES_PARALLEL_DIS_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/probes/dis.h>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/executor.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/size.h>
+#include "../detail/fork_join.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+namespace probe
+{
+    namespace detail
+    {
+        // Minimal number of elements handled by each thread of
+        // the parallel algorithm
+        constexpr std::ptrdiff_t parallel_dis_min_chunk_size = 1 << 15;
+
+        ////////////////////////////////////////////////////////////
+        // Parallel algorithm for random-access iterators
+        //
+        // With LR the cumulative max from left to right and RL the
+        // cumulative min from right to left, the result is the
+        // biggest j - i such as RL[j] < LR[i]. Both are computed
+        // with a parallel scan, then every thread walks a chunk of
+        // LR with a second pointer into RL: both being sorted, the
+        // pointer only ever moves forward
+
+        template<typename RandomAccessIterator, typename Compare, typename Projection>
+        auto parallel_dis_probe_algo(RandomAccessIterator first, RandomAccessIterator last,
+                                     cppsort::detail::difference_type_t<RandomAccessIterator> size,
+                                     utility::executor_ref executor, std::size_t nb_threads,
+                                     Compare compare, Projection projection)
+            -> ::cppsort::detail::difference_type_t<RandomAccessIterator>
+        {
+            using difference_type = ::cppsort::detail::difference_type_t<RandomAccessIterator>;
+            auto&& comp = utility::as_function(compare);
+            auto&& proj = utility::as_function(projection);
+
+            nb_threads = (std::min)(
+                nb_threads,
+                static_cast<std::size_t>(size / parallel_dis_min_chunk_size)
+            );
+            if (nb_threads < 2) {
+                return dis_probe_algo(std::move(first), std::move(last), size,
+                                      std::move(compare), std::move(projection),
+                                      std::random_access_iterator_tag{});
+            }
+
+            auto nb_chunks = static_cast<difference_type>(nb_threads);
+            auto chunk_begin = [&](std::size_t idx) {
+                auto chunk = static_cast<difference_type>(idx);
+                return size / nb_chunks * chunk + (std::min)(chunk, size % nb_chunks);
+            };
+            auto less = [&](RandomAccessIterator lhs, RandomAccessIterator rhs) {
+                return comp(proj(*lhs), proj(*rhs));
+            };
+
+            std::vector<RandomAccessIterator> lr(size);
+            std::vector<RandomAccessIterator> rl(size);
+
+            // Cumulative max and min of every chunk
+            cppsort::detail::fork_join(executor, nb_threads, [&](std::size_t chunk) {
+                auto chunk_first = chunk_begin(chunk);
+                auto chunk_last = chunk_begin(chunk + 1);
+                lr[chunk_first] = first + chunk_first;
+                for (auto idx = chunk_first + 1; idx != chunk_last; ++idx) {
+                    auto it = first + idx;
+                    lr[idx] = less(lr[idx - 1], it) ? it : lr[idx - 1];
+                }
+                rl[chunk_last - 1] = first + (chunk_last - 1);
+                for (auto idx = chunk_last - 1; idx != chunk_first; --idx) {
+                    auto it = first + (idx - 1);
+                    rl[idx - 1] = less(it, rl[idx]) ? it : rl[idx];
+                }
+            });
+
+            // Propagate the max and min of the previous and next
+            // chunks to every chunk
+            std::vector<RandomAccessIterator> lr_carry(nb_threads);
+            std::vector<RandomAccessIterator> rl_carry(nb_threads);
+            lr_carry[0] = lr[chunk_begin(1) - 1];
+            for (std::size_t chunk = 1; chunk < nb_threads; ++chunk) {
+                auto chunk_max = lr[chunk_begin(chunk + 1) - 1];
+                lr_carry[chunk] = less(lr_carry[chunk - 1], chunk_max) ? chunk_max : lr_carry[chunk - 1];
+            }
+            rl_carry[nb_threads - 1] = rl[chunk_begin(nb_threads - 1)];
+            for (auto chunk = nb_threads - 1; chunk > 0; --chunk) {
+                auto chunk_min = rl[chunk_begin(chunk - 1)];
+                rl_carry[chunk - 1] = less(chunk_min, rl_carry[chunk]) ? chunk_min : rl_carry[chunk];
+            }
+            cppsort::detail::fork_join(executor, nb_threads, [&](std::size_t chunk) {
+                auto chunk_first = chunk_begin(chunk);
+                auto chunk_last = chunk_begin(chunk + 1);
+                for (auto idx = chunk_first; idx != chunk_last; ++idx) {
+                    if (chunk > 0 && less(lr[idx], lr_carry[chunk - 1])) {
+                        lr[idx] = lr_carry[chunk - 1];
+                    }
+                    if (chunk < nb_threads - 1 && less(rl_carry[chunk + 1], rl[idx])) {
+                        rl[idx] = rl_carry[chunk + 1];
+                    }
+                }
+            });
+
+            // Biggest distance between an LR element and the last
+            // RL element smaller than it
+            std::vector<difference_type> chunk_res(nb_threads);
+            cppsort::detail::fork_join(executor, nb_threads, [&](std::size_t chunk) {
+                auto chunk_first = chunk_begin(chunk);
+                auto chunk_last = chunk_begin(chunk + 1);
+                auto j = std::partition_point(
+                    rl.begin(), rl.end(),
+                    [&](RandomAccessIterator it) { return less(it, lr[chunk_first]); }
+                ) - rl.begin();
+                difference_type res = 0;
+                for (auto i = chunk_first; i != chunk_last; ++i) {
+                    while (j != size && less(rl[j], lr[i])) {
+                        ++j;
+                    }
+                    res = (std::max)(res, j - 1 - i);
+                }
+                chunk_res[chunk] = res;
+            });
+            return *std::max_element(chunk_res.begin(), chunk_res.end());
+        }
+
+        template<typename RandomAccessIterator, typename Compare, typename Projection>
+        auto parallel_dis_probe_algo(RandomAccessIterator first, RandomAccessIterator last,
+                                     cppsort::detail::difference_type_t<RandomAccessIterator> size,
+                                     utility::executor_ref executor, std::size_t nb_threads,
+                                     Compare compare, Projection projection,
+                                     std::random_access_iterator_tag)
+            -> ::cppsort::detail::difference_type_t<RandomAccessIterator>
+        {
+            try {
+                return parallel_dis_probe_algo(first, last, size, executor, nb_threads,
+                                               compare, projection);
+            } catch (std::bad_alloc&) {
+                return inplace_dis_probe_algo(
+                    first, last, size,
+                    std::move(compare), std::move(projection)
+                );
+            }
+        }
+
+        template<typename ForwardIterator, typename Compare, typename Projection>
+        auto parallel_dis_probe_algo(ForwardIterator first, ForwardIterator last,
+                                     cppsort::detail::difference_type_t<ForwardIterator> size,
+                                     utility::executor_ref, std::size_t,
+                                     Compare compare, Projection projection,
+                                     std::forward_iterator_tag category)
+            -> ::cppsort::detail::difference_type_t<ForwardIterator>
+        {
+            return dis_probe_algo(std::move(first), std::move(last), size,
+                                  std::move(compare), std::move(projection),
+                                  category);
+        }
+
+        struct parallel_dis_impl
+        {
+            // Maximal number of threads, 0 meaning as many
+            // threads as the executor can run concurrently
+            std::size_t max_threads = 0;
+            // Executor running the tasks, the default thread
+            // pool when none is given
+            utility::executor_ref executor;
+
+            parallel_dis_impl() = default;
+
+            constexpr explicit parallel_dis_impl(std::size_t nb_threads) noexcept:
+                max_threads(nb_threads)
+            {}
+
+            constexpr explicit parallel_dis_impl(utility::executor_ref executor,
+                                                 std::size_t nb_threads=0) noexcept:
+                max_threads(nb_threads),
+                executor(executor)
+            {}
+
+            // The probe can run on several threads
+            using is_parallel = std::true_type;
+
+            template<
+                typename ForwardIterable,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = cppsort::detail::enable_if_t<
+                    is_projection_v<Projection, ForwardIterable, Compare>
+                >
+            >
+            auto operator()(ForwardIterable&& iterable, Compare compare={}, Projection projection={}) const
+                -> decltype(auto)
+            {
+                using category = cppsort::detail::iterator_category_t<
+                    cppsort::detail::remove_cvref_t<decltype(std::begin(iterable))>
+                >;
+                return parallel_dis_probe_algo(std::begin(iterable), std::end(iterable),
+                                               utility::size(iterable),
+                                               executor,
+                                               cppsort::detail::parallelism(max_threads, executor),
+                                               std::move(compare), std::move(projection),
+                                               category{});
+            }
+
+            template<
+                typename ForwardIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = cppsort::detail::enable_if_t<
+                    is_projection_iterator_v<Projection, ForwardIterator, Compare>
+                >
+            >
+            auto operator()(ForwardIterator first, ForwardIterator last,
+                            Compare compare={}, Projection projection={}) const
+                -> decltype(auto)
+            {
+                using category = cppsort::detail::iterator_category_t<ForwardIterator>;
+                return parallel_dis_probe_algo(first, last, std::distance(first, last),
+                                               executor,
+                                               cppsort::detail::parallelism(max_threads, executor),
+                                               std::move(compare), std::move(projection),
+                                               category{});
+            }
+
+            template<typename Integer>
+            static constexpr auto max_for_size(Integer n)
+                -> Integer
+            {
+                return n == 0 ? 0 : n - 1;
+            }
+        };
+    }
+
+    struct parallel_dis:
+        sorter_facade<detail::parallel_dis_impl>
+    {
+        ////////////////////////////////////////////////////////////
+        // Construction
+
+        parallel_dis() = default;
+
+        constexpr explicit parallel_dis(std::size_t max_threads) noexcept:
+            sorter_facade<detail::parallel_dis_impl>(max_threads)
+        {}
+
+        constexpr explicit parallel_dis(utility::executor_ref executor,
+                                        std::size_t max_threads=0) noexcept:
+            sorter_facade<detail::parallel_dis_impl>(executor, max_threads)
+        {}
+    };
+}}
+
+#endif // CPPSORT_PROBES_PARALLEL_DIS_H_
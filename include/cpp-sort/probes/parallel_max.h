@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_PROBES_PARALLEL_MAX_H_
+#define CPPSORT_PROBES_PARALLEL_MAX_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/probes/max.h>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/executor.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/size.h>
+#include "../detail/fork_join.h"
+#include "../detail/ips2ra.h"
+#include "../detail/ips4o.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+namespace probe
+{
+    namespace detail
+    {
+        ////////////////////////////////////////////////////////////
+        // Parallel algorithm for random-access iterators: the
+        // positions are sorted with IPS4o - or IPS2Ra when the
+        // default comparison allows it -, then every thread finds
+        // the runs of equivalent elements of its own chunk of the
+        // sorted positions and computes the distances of their
+        // elements to them
+
+        template<typename RandomAccessIterator, typename Compare, typename Projection>
+        using can_parallel_radix_sort_ranks = std::integral_constant<bool,
+            std::is_same<Compare, std::less<>>::value &&
+            cppsort::detail::is_ips2ra_sortable<
+                cppsort::detail::projected_t<RandomAccessIterator, Projection>
+            >::value
+        >;
+
+        template<typename RandomAccessIterator, typename Compare, typename Projection>
+        auto parallel_sort_ranks_order(RandomAccessIterator first, RandomAccessIterator last,
+                                       utility::executor_ref executor, std::size_t nb_threads,
+                                       Compare, Projection projection, std::true_type)
+            -> void
+        {
+            cppsort::detail::ips2ra_sort(std::move(first), std::move(last),
+                                         executor, nb_threads, std::move(projection));
+        }
+
+        template<typename RandomAccessIterator, typename Compare, typename Projection>
+        auto parallel_sort_ranks_order(RandomAccessIterator first, RandomAccessIterator last,
+                                       utility::executor_ref executor, std::size_t nb_threads,
+                                       Compare compare, Projection projection, std::false_type)
+            -> void
+        {
+            cppsort::detail::ips4o_sort(std::move(first), std::move(last), executor, nb_threads,
+                                        std::move(compare), std::move(projection));
+        }
+
+        template<typename RandomAccessIterator, typename Compare, typename Projection>
+        auto parallel_max_probe_algo(RandomAccessIterator first, RandomAccessIterator last,
+                                     cppsort::detail::difference_type_t<RandomAccessIterator> size,
+                                     utility::executor_ref executor, std::size_t nb_threads,
+                                     Compare compare, Projection projection)
+            -> ::cppsort::detail::difference_type_t<RandomAccessIterator>
+        {
+            using difference_type = ::cppsort::detail::difference_type_t<RandomAccessIterator>;
+            auto&& comp = utility::as_function(compare);
+            auto&& proj = utility::as_function(projection);
+
+            nb_threads = (std::min)(
+                nb_threads,
+                static_cast<std::size_t>(size / cppsort::detail::ips4o_min_chunk_size)
+            );
+            if (nb_threads < 2) {
+                return max_probe_algo(std::move(first), std::move(last), size,
+                                      std::move(compare), std::move(projection));
+            }
+
+            auto nb_chunks = static_cast<difference_type>(nb_threads);
+            auto chunk_begin = [&](std::size_t idx) {
+                auto chunk = static_cast<difference_type>(idx);
+                return size / nb_chunks * chunk + (std::min)(chunk, size % nb_chunks);
+            };
+
+            std::vector<difference_type> order(size);
+            cppsort::detail::fork_join(executor, nb_threads, [&](std::size_t idx) {
+                for (auto pos = chunk_begin(idx), end = chunk_begin(idx + 1); pos != end; ++pos) {
+                    order[pos] = pos;
+                }
+            });
+            auto pos_proj = [first, &proj](difference_type pos) -> decltype(auto) {
+                return proj(first[pos]);
+            };
+            parallel_sort_ranks_order(
+                order.begin(), order.end(), executor, nb_threads, compare, pos_proj,
+                can_parallel_radix_sort_ranks<RandomAccessIterator, Compare, Projection>{}
+            );
+
+            // Whether the element at the given sorted position is
+            // equivalent to the one before it
+            auto same_run = [&](difference_type idx) {
+                return not comp(pos_proj(order[idx - 1]), pos_proj(order[idx]));
+            };
+
+            std::vector<difference_type> chunk_res(nb_threads);
+            cppsort::detail::fork_join(executor, nb_threads, [&](std::size_t chunk) {
+                auto chunk_first = chunk_begin(chunk);
+                auto chunk_last = chunk_begin(chunk + 1);
+
+                // Runs can start before the chunk and end after it
+                auto run_begin = chunk_first;
+                while (run_begin != 0 && same_run(run_begin)) {
+                    --run_begin;
+                }
+                difference_type res = 0;
+                while (run_begin < chunk_last) {
+                    auto run_end = run_begin + 1;
+                    while (run_end != size && same_run(run_end)) {
+                        ++run_end;
+                    }
+                    res = (std::max)(
+                        max_in_run(order, run_begin, run_end,
+                                   (std::max)(run_begin, chunk_first),
+                                   (std::min)(run_end, chunk_last)),
+                        res
+                    );
+                    run_begin = run_end;
+                }
+                chunk_res[chunk] = res;
+            });
+            return *std::max_element(chunk_res.begin(), chunk_res.end());
+        }
+
+        template<typename RandomAccessIterator, typename Compare, typename Projection>
+        auto parallel_max_probe_algo(RandomAccessIterator first, RandomAccessIterator last,
+                                     cppsort::detail::difference_type_t<RandomAccessIterator> size,
+                                     utility::executor_ref executor, std::size_t nb_threads,
+                                     Compare compare, Projection projection,
+                                     std::random_access_iterator_tag)
+            -> ::cppsort::detail::difference_type_t<RandomAccessIterator>
+        {
+            return parallel_max_probe_algo(std::move(first), std::move(last), size,
+                                           executor, nb_threads,
+                                           std::move(compare), std::move(projection));
+        }
+
+        template<typename ForwardIterator, typename Compare, typename Projection>
+        auto parallel_max_probe_algo(ForwardIterator first, ForwardIterator last,
+                                     cppsort::detail::difference_type_t<ForwardIterator> size,
+                                     utility::executor_ref, std::size_t,
+                                     Compare compare, Projection projection,
+                                     std::forward_iterator_tag)
+            -> ::cppsort::detail::difference_type_t<ForwardIterator>
+        {
+            return max_probe_algo(std::move(first), std::move(last), size,
+                                  std::move(compare), std::move(projection));
+        }
+
+        struct parallel_max_impl
+        {
+            // Maximal number of threads, 0 meaning as many
+            // threads as the executor can run concurrently
+            std::size_t max_threads = 0;
+            // Executor running the tasks, the default thread
+            // pool when none is given
+            utility::executor_ref executor;
+
+            parallel_max_impl() = default;
+
+            constexpr explicit parallel_max_impl(std::size_t nb_threads) noexcept:
+                max_threads(nb_threads)
+            {}
+
+            constexpr explicit parallel_max_impl(utility::executor_ref executor,
+                                                 std::size_t nb_threads=0) noexcept:
+                max_threads(nb_threads),
+                executor(executor)
+            {}
+
+            // The probe can run on several threads
+            using is_parallel = std::true_type;
+
+            template<
+                typename ForwardIterable,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = cppsort::detail::enable_if_t<
+                    is_projection_v<Projection, ForwardIterable, Compare>
+                >
+            >
+            auto operator()(ForwardIterable&& iterable,
+                            Compare compare={}, Projection projection={}) const
+                -> decltype(auto)
+            {
+                using category = cppsort::detail::iterator_category_t<
+                    cppsort::detail::remove_cvref_t<decltype(std::begin(iterable))>
+                >;
+                return parallel_max_probe_algo(std::begin(iterable), std::end(iterable),
+                                               utility::size(iterable),
+                                               executor,
+                                               cppsort::detail::parallelism(max_threads, executor),
+                                               std::move(compare), std::move(projection),
+                                               category{});
+            }
+
+            template<
+                typename ForwardIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = cppsort::detail::enable_if_t<
+                    is_projection_iterator_v<Projection, ForwardIterator, Compare>
+                >
+            >
+            auto operator()(ForwardIterator first, ForwardIterator last,
+                            Compare compare={}, Projection projection={}) const
+                -> decltype(auto)
+            {
+                using category = cppsort::detail::iterator_category_t<ForwardIterator>;
+                auto dist = std::distance(first, last);
+                return parallel_max_probe_algo(std::move(first), std::move(last), dist,
+                                               executor,
+                                               cppsort::detail::parallelism(max_threads, executor),
+                                               std::move(compare), std::move(projection),
+                                               category{});
+            }
+
+            template<typename Integer>
+            static constexpr auto max_for_size(Integer n)
+                -> Integer
+            {
+                return n == 0 ? 0 : n - 1;
+            }
+        };
+    }
+
+    struct parallel_max:
+        sorter_facade<detail::parallel_max_impl>
+    {
+        ////////////////////////////////////////////////////////////
+        // Construction
+
+        parallel_max() = default;
+
+        constexpr explicit parallel_max(std::size_t max_threads) noexcept:
+            sorter_facade<detail::parallel_max_impl>(max_threads)
+        {}
+
+        constexpr explicit parallel_max(utility::executor_ref executor,
+                                        std::size_t max_threads=0) noexcept:
+            sorter_facade<detail::parallel_max_impl>(executor, max_threads)
+        {}
+    };
+}}
+
+#endif // CPPSORT_PROBES_PARALLEL_MAX_H_
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_PROBES_PRESORTEDNESS_REPORT_H_
+#define CPPSORT_PROBES_PRESORTEDNESS_REPORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <utility>
+#include <vector>
+#include <cpp-sort/probes/enc.h>
+#include <cpp-sort/probes/exc.h>
+#include <cpp-sort/probes/ham.h>
+#include <cpp-sort/probes/max.h>
+#include <cpp-sort/probes/sorted_ranks.h>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/size.h>
+#include <cpp-sort/utility/static_const.h>
+#include "../detail/iterator_traits.h"
+#include "../detail/lower_bound.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+namespace probe
+{
+    ////////////////////////////////////////////////////////////
+    // Values of every measure of presortedness
+
+    template<typename DifferenceType>
+    struct presortedness_measures
+    {
+        DifferenceType block;
+        DifferenceType dis;
+        DifferenceType enc;
+        DifferenceType exc;
+        DifferenceType ham;
+        DifferenceType inv;
+        DifferenceType max;
+        DifferenceType mono;
+        DifferenceType osc;
+        DifferenceType rem;
+        DifferenceType runs;
+        DifferenceType sus;
+    };
+
+    namespace detail
+    {
+        template<typename DifferenceType>
+        auto presortedness_report_from_ranks(const sorted_ranks<DifferenceType>& ranks)
+            -> presortedness_measures<DifferenceType>
+        {
+            using difference_type = DifferenceType;
+
+            const auto& rank = ranks.rank;
+            const auto& rank_end = ranks.rank_end;
+            const auto& order = ranks.order;
+            auto size = static_cast<difference_type>(rank.size());
+
+            presortedness_measures<difference_type> res = {};
+            if (size < 2) {
+                return res;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Measures comparing the position of the elements with
+            // their equal range in the sorted sequence
+
+            res.ham = ham_from_ranks(ranks);
+
+            res.max = max_from_ranks(ranks);
+
+            // Scratch buffers shared by the measures below, the rank
+            // of every element being in [0, size)
+            std::vector<difference_type> buffer1(size);
+            std::vector<difference_type> buffer2(size);
+
+            // Same algorithm as probe::osc
+            {
+                auto& cross = buffer1; // Still zero-initialized
+                for (difference_type pos = 1; pos < size; ++pos) {
+                    difference_type min_idx, max_idx;
+                    if (rank[pos - 1] < rank[pos]) {
+                        min_idx = rank_end[pos - 1];
+                        max_idx = rank[pos];
+                    } else if (rank[pos] < rank[pos - 1]) {
+                        min_idx = rank_end[pos];
+                        max_idx = rank[pos - 1];
+                    } else {
+                        continue;
+                    }
+                    cross[min_idx] += 1;
+                    cross[max_idx] -= 1;
+                }
+                std::partial_sum(cross.begin(), cross.end(), cross.begin());
+                res.osc = std::accumulate(cross.begin(), cross.end(), difference_type(0));
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Measures following the elements to their sorted position
+
+            res.exc = exc_from_ranks(ranks);
+
+            // Same algorithm as probe::block
+            for (difference_type sorted_pos = 0; sorted_pos < size - 1; ++sorted_pos) {
+                auto pos = order[sorted_pos];
+                if (pos + 1 == size) {
+                    if (rank[pos] != rank[order[size - 1]]) {
+                        ++res.block;
+                    }
+                } else if (rank[pos + 1] != rank[order[sorted_pos + 1]]) {
+                    ++res.block;
+                }
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Measures only comparing elements, computed with the
+            // ranks in place of the elements
+
+            // Single pass over the ranks for the following measures:
+            // - Runs: number of step-downs
+            // - Mono: same state machine as probe::mono, a run ends
+            //   with the pair of elements breaking it
+            // - Dis: the farthest element bigger than rank[pos] is
+            //   the first one, first_bigger[r] is the position of the
+            //   first element bigger than r, filled as the cumulative
+            //   max grows
+            // - Inv: a Fenwick tree counts the previous elements with
+            //   a rank smaller than or equal to rank[pos]
+            {
+                auto& first_bigger = buffer1;
+                auto& fenwick_tree = buffer2;
+                std::fill(fenwick_tree.begin(), fenwick_tree.end(), difference_type(0));
+                for (auto idx = rank[0] + 1; idx <= size; idx += idx & -idx) {
+                    ++fenwick_tree[idx - 1];
+                }
+
+                enum { mono_none, mono_ascending, mono_descending } mono_state = mono_none;
+                auto cummax = rank[0];
+                std::fill(first_bigger.begin(), first_bigger.begin() + cummax, difference_type(0));
+                for (difference_type pos = 1; pos < size; ++pos) {
+                    auto prev = rank[pos - 1];
+                    auto value = rank[pos];
+
+                    if (value < prev) {
+                        ++res.runs;
+                    }
+
+                    if (mono_state == mono_none) {
+                        if (prev < value) {
+                            mono_state = mono_ascending;
+                        } else if (value < prev) {
+                            mono_state = mono_descending;
+                        }
+                    } else if (mono_state == mono_ascending ? value < prev : prev < value) {
+                        ++res.mono;
+                        mono_state = mono_none;
+                    }
+
+                    if (value < cummax) {
+                        res.dis = (std::max)(res.dis, pos - first_bigger[value]);
+                    } else {
+                        std::fill(first_bigger.begin() + cummax, first_bigger.begin() + value, pos);
+                        cummax = value;
+                    }
+
+                    difference_type nb_not_bigger = 0;
+                    for (auto idx = value + 1; idx > 0; idx &= idx - 1) {
+                        nb_not_bigger += fenwick_tree[idx - 1];
+                    }
+                    res.inv += pos - nb_not_bigger;
+                    for (auto idx = value + 1; idx <= size; idx += idx & -idx) {
+                        ++fenwick_tree[idx - 1];
+                    }
+                }
+            }
+
+            res.enc = enc(rank);
+
+            // Rem and Sus from the longest non-decreasing and strictly
+            // decreasing subsequences, both computed with patience
+            // sorting, the top of the stacks being stored in the
+            // scratch buffers - the ranks being integers, the upper
+            // bound of a rank is the lower bound of the next one,
+            // which allows to use the branchless binary search
+            {
+                difference_type lnds_size = 0;
+                difference_type lds_size = 0;
+                for (auto value: rank) {
+                    auto lnds_it = cppsort::detail::lower_monobound_n(
+                        buffer1.begin(), lnds_size, value + 1,
+                        std::less<>{}, utility::identity{}
+                    );
+                    *lnds_it = value;
+                    if (lnds_it == buffer1.begin() + lnds_size) {
+                        ++lnds_size;
+                    }
+
+                    // Strictly decreasing ranks are strictly increasing
+                    // reverse ranks
+                    auto reverse_value = size - 1 - value;
+                    auto lds_it = cppsort::detail::lower_monobound_n(
+                        buffer2.begin(), lds_size, reverse_value,
+                        std::less<>{}, utility::identity{}
+                    );
+                    *lds_it = reverse_value;
+                    if (lds_it == buffer2.begin() + lds_size) {
+                        ++lds_size;
+                    }
+                }
+                res.rem = size - lnds_size;
+                res.sus = lds_size - 1;
+            }
+
+            return res;
+        }
+
+        template<typename ForwardIterator, typename Compare, typename Projection>
+        auto presortedness_report_algo(ForwardIterator first, ForwardIterator last,
+                                       cppsort::detail::difference_type_t<ForwardIterator> size,
+                                       Compare compare, Projection projection)
+            -> presortedness_measures<cppsort::detail::difference_type_t<ForwardIterator>>
+        {
+            // The elements are only ever compared here, every measure
+            // is then computed from the sorted ranks of the elements,
+            // which compare like the elements themselves
+            auto ranks = sorted_ranks_algo(first, last, size,
+                                           std::move(compare), std::move(projection));
+            return presortedness_report_from_ranks(ranks);
+        }
+
+        struct presortedness_report_impl
+        {
+            template<
+                typename ForwardIterable,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = cppsort::detail::enable_if_t<
+                    is_projection_v<Projection, ForwardIterable, Compare>
+                >
+            >
+            auto operator()(ForwardIterable&& iterable,
+                            Compare compare={}, Projection projection={}) const
+                -> decltype(auto)
+            {
+                return presortedness_report_algo(std::begin(iterable), std::end(iterable),
+                                                 utility::size(iterable),
+                                                 std::move(compare), std::move(projection));
+            }
+
+            template<
+                typename ForwardIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = cppsort::detail::enable_if_t<
+                    is_projection_iterator_v<Projection, ForwardIterator, Compare>
+                >
+            >
+            auto operator()(ForwardIterator first, ForwardIterator last,
+                            Compare compare={}, Projection projection={}) const
+                -> decltype(auto)
+            {
+                return presortedness_report_algo(first, last, std::distance(first, last),
+                                                 std::move(compare), std::move(projection));
+            }
+
+            template<typename DifferenceType>
+            auto operator()(const sorted_ranks<DifferenceType>& ranks) const
+                -> presortedness_measures<DifferenceType>
+            {
+                return presortedness_report_from_ranks(ranks);
+            }
+        };
+    }
+
+    namespace
+    {
+        constexpr auto&& presortedness_report = utility::static_const<
+            sorter_facade<detail::presortedness_report_impl>
+        >::value;
+    }
+}}
+
+#endif // CPPSORT_PROBES_PRESORTEDNESS_REPORT_H_
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_PROBES_SORTED_RANKS_H_
+#define CPPSORT_PROBES_SORTED_RANKS_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/size.h>
+#include <cpp-sort/utility/static_const.h>
+#include "../detail/immovable_vector.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/pdqsort.h"
+#include "../detail/ska_sort.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+namespace probe
+{
+    ////////////////////////////////////////////////////////////
+    // Position of the elements of a sequence once sorted
+    //
+    // For the element at a given position in the original
+    // sequence, rank holds the position in the sorted sequence
+    // of the first element equivalent to it and rank_end the
+    // position past the last one: [rank, rank_end) is the
+    // equal range of the element once sorted. Two elements
+    // compare like their ranks, and are equivalent if and only
+    // if they have the same rank.
+    //
+    // order holds the original position of every element of
+    // the sorted sequence, equivalent elements keeping their
+    // original relative order.
+
+    template<typename DifferenceType>
+    struct sorted_ranks
+    {
+        std::vector<DifferenceType> rank;
+        std::vector<DifferenceType> rank_end;
+        std::vector<DifferenceType> order;
+    };
+
+    namespace detail
+    {
+        // Radix sort the iterators when the comparison is the
+        // default one and the projected elements allow it
+
+        template<typename ForwardIterator, typename Compare, typename Projection>
+        using can_radix_sort_ranks = std::integral_constant<bool,
+            std::is_same<Compare, std::less<>>::value &&
+            cppsort::detail::is_ska_sortable_v<
+                cppsort::detail::projected_t<ForwardIterator, Projection>
+            >
+        >;
+
+        template<typename RandomAccessIterator, typename Compare, typename Projection>
+        auto sort_ranks_iterators(RandomAccessIterator first, RandomAccessIterator last,
+                                  Compare, Projection projection, std::true_type)
+            -> void
+        {
+            cppsort::detail::ska_sort(std::move(first), std::move(last), std::move(projection));
+        }
+
+        template<typename RandomAccessIterator, typename Compare, typename Projection>
+        auto sort_ranks_iterators(RandomAccessIterator first, RandomAccessIterator last,
+                                  Compare compare, Projection projection, std::false_type)
+            -> void
+        {
+            cppsort::detail::pdqsort(std::move(first), std::move(last),
+                                     std::move(compare), std::move(projection));
+        }
+
+        // Fill order with the original positions of the elements
+        // in sorted order - equivalent elements in any order -, and
+        // mark the sorted positions where runs of equivalent elements
+        // start in run_starts
+
+        template<typename ForwardIterator, typename Compare, typename Projection>
+        auto sort_ranks_order(ForwardIterator first, ForwardIterator last,
+                              cppsort::detail::difference_type_t<ForwardIterator> size,
+                              Compare compare, Projection projection,
+                              std::vector<cppsort::detail::difference_type_t<ForwardIterator>>& order,
+                              std::vector<bool>& run_starts,
+                              std::forward_iterator_tag)
+            -> void
+        {
+            using difference_type = cppsort::detail::difference_type_t<ForwardIterator>;
+            auto&& comp = utility::as_function(compare);
+            auto&& proj = utility::as_function(projection);
+
+            // Indirectly sort the iterators along with the original
+            // position of the element they point to
+            using iterator_pos = std::pair<ForwardIterator, difference_type>;
+            cppsort::detail::immovable_vector<iterator_pos> iterators(size);
+            {
+                difference_type pos = 0;
+                for (auto it = first; it != last; ++it) {
+                    iterators.emplace_back(it, pos);
+                    ++pos;
+                }
+            }
+            sort_ranks_iterators(
+                iterators.begin(), iterators.end(), compare,
+                &iterator_pos::first | utility::indirect{} | projection,
+                can_radix_sort_ranks<ForwardIterator, Compare, Projection>{}
+            );
+
+            order[0] = iterators[0].second;
+            for (difference_type idx = 1; idx != size; ++idx) {
+                order[idx] = iterators[idx].second;
+                run_starts[idx] = comp(proj(*iterators[idx - 1].first), proj(*iterators[idx].first));
+            }
+        }
+
+        template<typename RandomAccessIterator, typename Compare, typename Projection>
+        auto sort_ranks_order(RandomAccessIterator first, RandomAccessIterator,
+                              cppsort::detail::difference_type_t<RandomAccessIterator> size,
+                              Compare compare, Projection projection,
+                              std::vector<cppsort::detail::difference_type_t<RandomAccessIterator>>& order,
+                              std::vector<bool>& run_starts,
+                              std::random_access_iterator_tag)
+            -> void
+        {
+            using difference_type = cppsort::detail::difference_type_t<RandomAccessIterator>;
+            auto&& comp = utility::as_function(compare);
+            auto&& proj = utility::as_function(projection);
+
+            // Sort the positions directly
+            for (difference_type idx = 0; idx != size; ++idx) {
+                order[idx] = idx;
+            }
+            sort_ranks_iterators(
+                order.begin(), order.end(), compare,
+                [first, &proj](difference_type pos) -> decltype(auto) {
+                    return proj(first[pos]);
+                },
+                can_radix_sort_ranks<RandomAccessIterator, Compare, Projection>{}
+            );
+
+            for (difference_type idx = 1; idx != size; ++idx) {
+                run_starts[idx] = comp(proj(first[order[idx - 1]]), proj(first[order[idx]]));
+            }
+        }
+
+        template<typename ForwardIterator, typename Compare, typename Projection>
+        auto sorted_ranks_algo(ForwardIterator first, ForwardIterator last,
+                               cppsort::detail::difference_type_t<ForwardIterator> size,
+                               Compare compare, Projection projection)
+            -> sorted_ranks<cppsort::detail::difference_type_t<ForwardIterator>>
+        {
+            using difference_type = cppsort::detail::difference_type_t<ForwardIterator>;
+            using category = cppsort::detail::iterator_category_t<ForwardIterator>;
+
+            sorted_ranks<difference_type> res;
+            if (size == 0) {
+                return res;
+            }
+            res.rank.resize(size);
+            res.rank_end.resize(size);
+            res.order.resize(size);
+
+            std::vector<bool> run_starts(size, true);
+            sort_ranks_order(first, last, size, std::move(compare), std::move(projection),
+                             res.order, run_starts, category{});
+
+            // Put the original positions of equivalent elements back
+            // in order, and give them the bounds of their run
+            for (difference_type run_begin = 0; run_begin != size;) {
+                auto run_end = run_begin + 1;
+                while (run_end != size && not run_starts[run_end]) {
+                    ++run_end;
+                }
+                if (run_end - run_begin > 1) {
+                    cppsort::detail::pdqsort(res.order.begin() + run_begin, res.order.begin() + run_end,
+                                             std::less<>{}, utility::identity{});
+                }
+                for (auto idx = run_begin; idx != run_end; ++idx) {
+                    res.rank[res.order[idx]] = run_begin;
+                    res.rank_end[res.order[idx]] = run_end;
+                }
+                run_begin = run_end;
+            }
+            return res;
+        }
+
+        struct compute_sorted_ranks_impl
+        {
+            template<
+                typename ForwardIterable,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = cppsort::detail::enable_if_t<
+                    is_projection_v<Projection, ForwardIterable, Compare>
+                >
+            >
+            auto operator()(ForwardIterable&& iterable,
+                            Compare compare={}, Projection projection={}) const
+                -> decltype(auto)
+            {
+                return sorted_ranks_algo(std::begin(iterable), std::end(iterable),
+                                         utility::size(iterable),
+                                         std::move(compare), std::move(projection));
+            }
+
+            template<
+                typename ForwardIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = cppsort::detail::enable_if_t<
+                    is_projection_iterator_v<Projection, ForwardIterator, Compare>
+                >
+            >
+            auto operator()(ForwardIterator first, ForwardIterator last,
+                            Compare compare={}, Projection projection={}) const
+                -> decltype(auto)
+            {
+                return sorted_ranks_algo(first, last, std::distance(first, last),
+                                         std::move(compare), std::move(projection));
+            }
+        };
+    }
+
+    namespace
+    {
+        constexpr auto&& compute_sorted_ranks = utility::static_const<
+            sorter_facade<detail::compute_sorted_ranks_impl>
+        >::value;
+    }
+}}
+
+#endif // CPPSORT_PROBES_SORTED_RANKS_H_
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2021 Morwenn
+ * Copyright (c) 2015-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_SORTER_FACADE_H_
@@ -8,10 +8,12 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <cstddef>
 #include <functional>
 #include <type_traits>
 #include <utility>
 #include <cpp-sort/comparators/projection_compare.h>
+#include <cpp-sort/execution.h>
 #include <cpp-sort/refined.h>
 #include <cpp-sort/sorter_traits.h>
 #include <cpp-sort/utility/functional.h>
@@ -139,6 +141,33 @@ namespace cppsort
 
         template<typename Sorter>
         class sorter_facade_fptr<Sorter, false> {};
+
+        // Call a sorter under an execution policy: sorters that can't
+        // use several threads ignore it, parallel sorters are given
+        // the maximal number of threads of the policy when it has one
+
+        template<typename Sorter, typename... Args>
+        constexpr auto execute_sorter(const Sorter& sorter, std::false_type,
+                                      std::size_t, Args&&... args)
+            -> decltype(auto)
+        {
+            return sorter(std::forward<Args>(args)...);
+        }
+
+        template<typename Sorter, typename... Args>
+        constexpr auto execute_sorter(const Sorter& sorter, std::true_type,
+                                      std::size_t max_threads, Args&&... args)
+            -> decltype(auto)
+        {
+            if (max_threads == 0) {
+                return sorter(std::forward<Args>(args)...);
+            }
+            // Copy the sorter to keep the rest of its state, such
+            // as the executor it runs on
+            auto limited_sorter = sorter;
+            limited_sorter.max_threads = max_threads;
+            return limited_sorter(std::forward<Args>(args)...);
+        }
     }
 
     // This class takes an incomplete sorter, analyses it and creates
@@ -1172,6 +1201,21 @@ namespace cppsort
                 refined<decltype(*std::begin(iterable))>(std::move(compare)),
                 refined<decltype(*std::begin(iterable))>(std::move(projection))));
         }
+
+        ////////////////////////////////////////////////////////////
+        // Execution policy overloads
+
+        template<typename ExecutionPolicy, typename... Args>
+        constexpr auto operator()(ExecutionPolicy&& policy, Args&&... args) const
+            -> detail::enable_if_t<
+                is_execution_policy_v<detail::remove_cvref_t<ExecutionPolicy>>,
+                decltype(std::declval<const sorter_facade&>()(std::forward<Args>(args)...))
+            >
+        {
+            return detail::execute_sorter(*this, is_parallel<Sorter>{},
+                                          detail::policy_max_threads(policy),
+                                          std::forward<Args>(args)...);
+        }
     };
 }
 
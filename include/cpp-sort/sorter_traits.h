@@ -237,6 +237,31 @@ namespace cppsort
     template<typename Arg>
     constexpr bool is_stable_v = is_stable<Arg>::value;
 
+    ////////////////////////////////////////////////////////////
+    // Whether a sorter can use several threads, in which case it
+    // is constructible from a maximal number of threads
+
+    namespace detail
+    {
+        template<typename Sorter, typename=void>
+        struct is_parallel_impl:
+            std::false_type
+        {};
+
+        template<typename Sorter>
+        struct is_parallel_impl<Sorter, void_t<typename Sorter::is_parallel>>:
+            Sorter::is_parallel
+        {};
+    }
+
+    template<typename Sorter>
+    struct is_parallel:
+        detail::is_parallel_impl<Sorter>
+    {};
+
+    template<typename Sorter>
+    constexpr bool is_parallel_v = is_parallel<Sorter>::value;
+
     ////////////////////////////////////////////////////////////
     // Fixed-size sorter traits
 
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_SORTERS_IPS2RA_SORTER_H_
+#define CPPSORT_SORTERS_IPS2RA_SORTER_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/executor.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/static_const.h>
+#include "../detail/fork_join.h"
+#include "../detail/ips2ra.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+    ////////////////////////////////////////////////////////////
+    // Sorter
+
+    namespace detail
+    {
+        struct ips2ra_sorter_impl
+        {
+            // Maximal number of threads, 0 meaning as many
+            // threads as the executor can run concurrently
+            std::size_t max_threads = 0;
+            // Executor running the tasks, the default thread
+            // pool when none is given
+            utility::executor_ref executor;
+
+            ips2ra_sorter_impl() = default;
+
+            constexpr explicit ips2ra_sorter_impl(std::size_t nb_threads) noexcept:
+                max_threads(nb_threads)
+            {}
+
+            constexpr explicit ips2ra_sorter_impl(utility::executor_ref executor,
+                                                  std::size_t nb_threads=0) noexcept:
+                max_threads(nb_threads),
+                executor(executor)
+            {}
+
+            template<
+                typename RandomAccessIterator,
+                typename Projection = utility::identity,
+                typename = detail::enable_if_t<
+                    is_projection_iterator_v<Projection, RandomAccessIterator>
+                >
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            Projection projection={}) const
+                -> detail::enable_if_t<detail::is_ips2ra_sortable<
+                    projected_t<RandomAccessIterator, Projection>
+                >::value>
+            {
+                static_assert(
+                    std::is_base_of<
+                        iterator_category,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "ips2ra_sorter requires at least random-access iterators"
+                );
+
+                detail::ips2ra_sort(std::move(first), std::move(last),
+                                    executor, parallelism(max_threads, executor),
+                                    std::move(projection));
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Sorter traits
+
+            using iterator_category = std::random_access_iterator_tag;
+            using is_always_stable = std::false_type;
+            using is_parallel = std::true_type;
+        };
+    }
+
+    struct ips2ra_sorter:
+        sorter_facade<detail::ips2ra_sorter_impl>
+    {
+        ////////////////////////////////////////////////////////////
+        // Construction
+
+        ips2ra_sorter() = default;
+
+        constexpr explicit ips2ra_sorter(std::size_t max_threads) noexcept:
+            sorter_facade<detail::ips2ra_sorter_impl>(max_threads)
+        {}
+
+        constexpr explicit ips2ra_sorter(utility::executor_ref executor,
+                                         std::size_t max_threads=0) noexcept:
+            sorter_facade<detail::ips2ra_sorter_impl>(executor, max_threads)
+        {}
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Sort function
+
+    namespace
+    {
+        constexpr auto&& ips2ra_sort
+            = utility::static_const<ips2ra_sorter>::value;
+    }
+}
+
+#endif // CPPSORT_SORTERS_IPS2RA_SORTER_H_
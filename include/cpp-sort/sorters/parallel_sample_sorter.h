@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_SORTERS_PARALLEL_SAMPLE_SORTER_H_
+#define CPPSORT_SORTERS_PARALLEL_SAMPLE_SORTER_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/adapters/stable_adapter.h>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/sorters/spin_sorter.h>
+#include <cpp-sort/utility/adapter_storage.h>
+#include <cpp-sort/utility/executor.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/static_const.h>
+#include "../detail/fork_join.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/parallel_sample_sort.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+    ////////////////////////////////////////////////////////////
+    // Sorter
+
+    namespace detail
+    {
+        template<typename Sorter>
+        struct parallel_sample_sorter_impl:
+            utility::adapter_storage<stable_t<Sorter>>
+        {
+            // Maximal number of threads, 0 meaning as many
+            // threads as the executor can run concurrently
+            std::size_t max_threads = 0;
+            // Executor running the tasks, the default thread
+            // pool when none is given
+            utility::executor_ref executor;
+
+            parallel_sample_sorter_impl() = default;
+
+            constexpr explicit parallel_sample_sorter_impl(std::size_t nb_threads) noexcept:
+                max_threads(nb_threads)
+            {}
+
+            constexpr explicit parallel_sample_sorter_impl(utility::executor_ref executor,
+                                                           std::size_t nb_threads=0) noexcept:
+                max_threads(nb_threads),
+                executor(executor)
+            {}
+
+            constexpr parallel_sample_sorter_impl(Sorter&& sorter, std::size_t nb_threads):
+                utility::adapter_storage<stable_t<Sorter>>(stable_t<Sorter>(std::move(sorter))),
+                max_threads(nb_threads)
+            {}
+
+            constexpr parallel_sample_sorter_impl(Sorter&& sorter, utility::executor_ref executor,
+                                                  std::size_t nb_threads):
+                utility::adapter_storage<stable_t<Sorter>>(stable_t<Sorter>(std::move(sorter))),
+                max_threads(nb_threads),
+                executor(executor)
+            {}
+
+            template<
+                typename RandomAccessIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = detail::enable_if_t<
+                    is_projection_iterator_v<Projection, RandomAccessIterator, Compare>
+                >
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            Compare compare={}, Projection projection={}) const
+                -> void
+            {
+                static_assert(
+                    std::is_base_of<
+                        iterator_category,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "parallel_sample_sorter requires at least random-access iterators"
+                );
+
+                parallel_sample_sort(std::move(first), std::move(last),
+                                     executor, parallelism(max_threads, executor),
+                                     this->get(),
+                                     std::move(compare), std::move(projection));
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Sorter traits
+
+            using iterator_category = std::random_access_iterator_tag;
+            using is_always_stable = std::true_type;
+            using is_parallel = std::true_type;
+        };
+    }
+
+    template<typename Sorter = spin_sorter>
+    struct parallel_sample_sorter:
+        sorter_facade<detail::parallel_sample_sorter_impl<Sorter>>
+    {
+        ////////////////////////////////////////////////////////////
+        // Construction
+
+        parallel_sample_sorter() = default;
+
+        constexpr explicit parallel_sample_sorter(std::size_t max_threads) noexcept:
+            sorter_facade<detail::parallel_sample_sorter_impl<Sorter>>(max_threads)
+        {}
+
+        constexpr explicit parallel_sample_sorter(utility::executor_ref executor,
+                                                  std::size_t max_threads=0) noexcept:
+            sorter_facade<detail::parallel_sample_sorter_impl<Sorter>>(executor, max_threads)
+        {}
+
+        constexpr explicit parallel_sample_sorter(Sorter sorter, std::size_t max_threads=0):
+            sorter_facade<detail::parallel_sample_sorter_impl<Sorter>>(std::move(sorter), max_threads)
+        {}
+
+        constexpr parallel_sample_sorter(Sorter sorter, utility::executor_ref executor,
+                                         std::size_t max_threads=0):
+            sorter_facade<detail::parallel_sample_sorter_impl<Sorter>>(
+                std::move(sorter), executor, max_threads
+            )
+        {}
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Sort function
+
+    namespace
+    {
+        constexpr auto&& parallel_sample_sort
+            = utility::static_const<parallel_sample_sorter<>>::value;
+    }
+}
+
+#endif // CPPSORT_SORTERS_PARALLEL_SAMPLE_SORTER_H_
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_SORTERS_PARALLEL_SPREAD_SORTER_H_
+#define CPPSORT_SORTERS_PARALLEL_SPREAD_SORTER_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/executor.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/static_const.h>
+#include "../detail/fork_join.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/spreadsort/parallel_sort.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+    ////////////////////////////////////////////////////////////
+    // Sorter
+
+    namespace detail
+    {
+        struct parallel_spread_sorter_impl
+        {
+            // Maximal number of threads, 0 meaning as many
+            // threads as the executor can run concurrently
+            std::size_t max_threads = 0;
+            // Executor running the tasks, the default thread
+            // pool when none is given
+            utility::executor_ref executor;
+
+            parallel_spread_sorter_impl() = default;
+
+            constexpr explicit parallel_spread_sorter_impl(std::size_t nb_threads) noexcept:
+                max_threads(nb_threads)
+            {}
+
+            constexpr explicit parallel_spread_sorter_impl(utility::executor_ref executor,
+                                                           std::size_t nb_threads=0) noexcept:
+                max_threads(nb_threads),
+                executor(executor)
+            {}
+
+            template<
+                typename RandomAccessIterator,
+                typename Projection = utility::identity
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            Projection projection={}) const
+                -> detail::enable_if_t<
+                    std::is_integral<projected_t<RandomAccessIterator, Projection>>::value &&
+                    sizeof(projected_t<RandomAccessIterator, Projection>) <= sizeof(std::uintmax_t) &&
+                    is_projection_iterator_v<Projection, RandomAccessIterator>
+                >
+            {
+                static_assert(
+                    std::is_base_of<
+                        iterator_category,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "parallel_spread_sorter requires at least random-access iterators"
+                );
+
+                spreadsort::parallel_integer_sort(std::move(first), std::move(last),
+                                                  executor, parallelism(max_threads, executor),
+                                                  std::move(projection));
+            }
+
+            template<
+                typename RandomAccessIterator,
+                typename Projection = utility::identity
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            Projection projection={}) const
+                -> detail::enable_if_t<
+                    std::numeric_limits<projected_t<RandomAccessIterator, Projection>>::is_iec559 && (
+                        sizeof(projected_t<RandomAccessIterator, Projection>) == sizeof(std::uint32_t) ||
+                        sizeof(projected_t<RandomAccessIterator, Projection>) == sizeof(std::uint64_t)
+                    ) &&
+                    is_projection_iterator_v<Projection, RandomAccessIterator>
+                >
+            {
+                static_assert(
+                    std::is_base_of<
+                        iterator_category,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "parallel_spread_sorter requires at least random-access iterators"
+                );
+
+                spreadsort::parallel_float_sort(std::move(first), std::move(last),
+                                                executor, parallelism(max_threads, executor),
+                                                std::move(projection));
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Sorter traits
+
+            using iterator_category = std::random_access_iterator_tag;
+            using is_always_stable = std::false_type;
+            using is_parallel = std::true_type;
+        };
+    }
+
+    struct parallel_spread_sorter:
+        sorter_facade<detail::parallel_spread_sorter_impl>
+    {
+        ////////////////////////////////////////////////////////////
+        // Construction
+
+        parallel_spread_sorter() = default;
+
+        constexpr explicit parallel_spread_sorter(std::size_t max_threads) noexcept:
+            sorter_facade<detail::parallel_spread_sorter_impl>(max_threads)
+        {}
+
+        constexpr explicit parallel_spread_sorter(utility::executor_ref executor,
+                                                  std::size_t max_threads=0) noexcept:
+            sorter_facade<detail::parallel_spread_sorter_impl>(executor, max_threads)
+        {}
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Sort function
+
+    namespace
+    {
+        constexpr auto&& parallel_spread_sort
+            = utility::static_const<parallel_spread_sorter>::value;
+    }
+}
+
+#endif // CPPSORT_SORTERS_PARALLEL_SPREAD_SORTER_H_
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_STD_EXECUTION_H_
+#define CPPSORT_STD_EXECUTION_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <execution>
+#include <type_traits>
+#include <cpp-sort/execution.h>
+
+namespace cppsort
+{
+    ////////////////////////////////////////////////////////////
+    // Standard library execution policies
+    //
+    // Including <execution> can require linking the parallel
+    // backend of the standard library, such as TBB with
+    // libstdc++, hence why this header is opt-in
+
+    template<>
+    struct is_execution_policy<std::execution::sequenced_policy>:
+        std::true_type
+    {};
+
+    template<>
+    struct is_execution_policy<std::execution::parallel_policy>:
+        std::true_type
+    {};
+
+    template<>
+    struct is_execution_policy<std::execution::parallel_unsequenced_policy>:
+        std::true_type
+    {};
+
+#if defined(__cpp_lib_execution) && __cpp_lib_execution >= 201902L
+    template<>
+    struct is_execution_policy<std::execution::unsequenced_policy>:
+        std::true_type
+    {};
+#endif
+
+    namespace detail
+    {
+        template<>
+        struct policy_threads<std::execution::sequenced_policy>
+        {
+            static constexpr auto max_threads(const std::execution::sequenced_policy&) noexcept
+                -> std::size_t
+            {
+                return 1;
+            }
+        };
+
+        template<>
+        struct policy_threads<std::execution::parallel_policy>
+        {
+            static constexpr auto max_threads(const std::execution::parallel_policy&) noexcept
+                -> std::size_t
+            {
+                return 0;
+            }
+        };
+
+        template<>
+        struct policy_threads<std::execution::parallel_unsequenced_policy>
+        {
+            static constexpr auto max_threads(const std::execution::parallel_unsequenced_policy&) noexcept
+                -> std::size_t
+            {
+                return 0;
+            }
+        };
+
+#if defined(__cpp_lib_execution) && __cpp_lib_execution >= 201902L
+        template<>
+        struct policy_threads<std::execution::unsequenced_policy>
+        {
+            static constexpr auto max_threads(const std::execution::unsequenced_policy&) noexcept
+                -> std::size_t
+            {
+                return 1;
+            }
+        };
+#endif
+    }
+}
+
+#endif // CPPSORT_STD_EXECUTION_H_
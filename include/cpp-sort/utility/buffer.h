@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2021 Morwenn
+ * Copyright (c) 2015-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_UTILITY_BUFFER_H_
@@ -11,6 +11,7 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <new>
 
 namespace cppsort
 {
@@ -258,6 +259,113 @@ namespace utility
             {}
         };
     };
+
+    ////////////////////////////////////////////////////////////
+    // Memory providers
+    //
+    // Unlike buffer providers, memory providers hand out raw
+    // memory in which algorithms construct their own elements:
+    // allocate(size) returns memory for size bytes suitably
+    // aligned for any fundamental type, and deallocate(ptr, size)
+    // gives it back. Memory providers are stateless.
+
+    struct heap_memory
+    {
+        auto allocate(std::size_t size) const
+            -> void*
+        {
+            return ::operator new(size);
+        }
+
+        auto deallocate(void* pointer, std::size_t size) const noexcept
+            -> void
+        {
+#ifdef __cpp_sized_deallocation
+            ::operator delete(pointer, size);
+#else
+            (void) size;
+            ::operator delete(pointer);
+#endif
+        }
+    };
+
+    namespace detail
+    {
+        // Biggest block of memory allocated by thread_local_memory
+        // in the current thread, freed when the thread exits
+
+        struct thread_local_block
+        {
+            void* memory = nullptr;
+            std::size_t size = 0;
+            bool in_use = false;
+
+            thread_local_block() = default;
+            thread_local_block(const thread_local_block&) = delete;
+            thread_local_block& operator=(const thread_local_block&) = delete;
+
+            ~thread_local_block()
+            {
+                release();
+            }
+
+            auto release() noexcept
+                -> void
+            {
+                heap_memory{}.deallocate(memory, size);
+                memory = nullptr;
+                size = 0;
+            }
+        };
+
+        inline auto get_thread_local_block() noexcept
+            -> thread_local_block&
+        {
+            thread_local thread_local_block block;
+            return block;
+        }
+    }
+
+    struct thread_local_memory
+    {
+        auto allocate(std::size_t size) const
+            -> void*
+        {
+            auto& block = detail::get_thread_local_block();
+            if (block.in_use) {
+                // The block is already used higher in the call stack
+                return heap_memory{}.allocate(size);
+            }
+            if (block.memory == nullptr || block.size < size) {
+                block.release();
+                block.memory = heap_memory{}.allocate(size);
+                block.size = size;
+            }
+            block.in_use = true;
+            return block.memory;
+        }
+
+        auto deallocate(void* pointer, std::size_t size) const noexcept
+            -> void
+        {
+            auto& block = detail::get_thread_local_block();
+            if (block.in_use && pointer == block.memory) {
+                block.in_use = false;
+            } else {
+                heap_memory{}.deallocate(pointer, size);
+            }
+        }
+
+        // Free the memory kept by the current thread, if any
+        static auto release() noexcept
+            -> void
+        {
+            auto& block = detail::get_thread_local_block();
+            if (not block.in_use) {
+                block.release();
+            }
+        }
+    };
 }}
 
 #endif // CPPSORT_UTILITY_BUFFER_H_
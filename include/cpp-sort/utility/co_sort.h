@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_CO_SORT_H_
+#define CPPSORT_UTILITY_CO_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/adapter_storage.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/sorted_indices.h>
+#include "../detail/config.h"
+#include "../detail/gather_permutation.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    namespace detail
+    {
+        ////////////////////////////////////////////////////////////
+        // Split the arguments of co_sort: the leading iterables are
+        // the columns, they can be followed by a comparison and a
+        // projection
+
+        template<typename T>
+        using begin_t = decltype(std::begin(std::declval<T&>()));
+
+        template<typename... Args>
+        struct count_leading_iterables:
+            std::integral_constant<std::size_t, 0>
+        {};
+
+        template<typename Head, typename... Tail>
+        struct count_leading_iterables<Head, Tail...>:
+            std::integral_constant<
+                std::size_t,
+                cppsort::detail::is_detected_v<begin_t, Head> ?
+                    1 + count_leading_iterables<Tail...>::value : 0
+            >
+        {};
+
+        template<std::size_t Idx, typename Tuple, typename Default>
+        auto get_or(Tuple& tuple, Default, std::true_type)
+            -> std::decay_t<std::tuple_element_t<Idx, Tuple>>
+        {
+            return std::get<Idx>(tuple);
+        }
+
+        template<std::size_t Idx, typename Tuple, typename Default>
+        auto get_or(Tuple&, Default value, std::false_type)
+            -> Default
+        {
+            return value;
+        }
+
+        // Element Idx of the tuple if it exists, value otherwise
+        template<std::size_t Idx, typename Tuple, typename Default>
+        auto get_or(Tuple& tuple, Default value)
+            -> decltype(auto)
+        {
+            using has_element = std::integral_constant<
+                bool,
+                (Idx < std::tuple_size<Tuple>::value)
+            >;
+            return get_or<Idx>(tuple, std::move(value), has_element{});
+        }
+
+        // Reorder a column according to the sorted keys
+        template<typename RandomAccessIterable, typename Index>
+        auto permute_column(RandomAccessIterable& column, const std::vector<Index>& indices)
+            -> void
+        {
+            CPPSORT_ASSERT( static_cast<std::size_t>(std::end(column) - std::begin(column)) == indices.size() );
+            cppsort::detail::gather_permutation(std::begin(column), std::end(column), indices.begin());
+        }
+
+        template<typename Index, typename Sorter, typename RandomAccessIterable,
+                 typename Tuple, std::size_t... Indices,
+                 typename Compare, typename Projection>
+        auto co_sort_columns(const Sorter& sorter, RandomAccessIterable& keys, Tuple& columns,
+                             std::index_sequence<Indices...>,
+                             Compare compare, Projection projection)
+            -> void
+        {
+            // Find the order of the keys with the adapted sorter
+            std::vector<Index> indices(std::end(keys) - std::begin(keys));
+            utility::sorted_indices<Sorter, Index>(sorter)
+                .into(keys, indices.begin(), std::move(compare), std::move(projection));
+
+            // Reorder the keys, then the columns one after the other
+            cppsort::detail::gather_permutation(std::begin(keys), std::end(keys), indices.begin());
+            (void)std::initializer_list<int>{
+                (permute_column(std::get<Indices>(columns), indices), 0)...
+            };
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Sort a collection of keys and reorder any number of
+    // collections of the same size, the columns, so that their
+    // elements follow the keys they correspond to
+
+    template<typename Sorter>
+    struct co_sort:
+        utility::adapter_storage<Sorter>
+    {
+        ////////////////////////////////////////////////////////////
+        // Construction
+
+        co_sort() = default;
+
+        constexpr explicit co_sort(Sorter sorter):
+            utility::adapter_storage<Sorter>(std::move(sorter))
+        {}
+
+        ////////////////////////////////////////////////////////////
+        // Sort the keys and the columns
+
+        template<typename RandomAccessIterable, typename... Args>
+        auto operator()(RandomAccessIterable&& keys, Args&&... args) const
+            -> void
+        {
+            constexpr auto nb_columns = detail::count_leading_iterables<Args...>::value;
+            static_assert(
+                sizeof...(Args) <= nb_columns + 2,
+                "co_sort only accepts a comparison and a projection after the columns"
+            );
+
+            auto args_tuple = std::forward_as_tuple(std::forward<Args>(args)...);
+            auto compare = detail::get_or<nb_columns>(args_tuple, std::less<>{});
+            auto projection = detail::get_or<nb_columns + 1>(args_tuple, utility::identity{});
+            static_assert(
+                is_projection_v<decltype(projection), RandomAccessIterable, decltype(compare)>,
+                "co_sort requires a comparison and a projection callable with the keys"
+            );
+
+            static_assert(
+                std::is_base_of<
+                    std::random_access_iterator_tag,
+                    cppsort::detail::iterator_category_t<decltype(std::begin(keys))>
+                >::value,
+                "co_sort requires random-access collections"
+            );
+
+            // Narrow indices are cheaper to sort
+            auto size = std::end(keys) - std::begin(keys);
+            if (static_cast<std::uintmax_t>(size) <= (std::numeric_limits<std::uint32_t>::max)()) {
+                detail::co_sort_columns<std::uint32_t>(
+                    this->get(), keys, args_tuple, std::make_index_sequence<nb_columns>{},
+                    std::move(compare), std::move(projection)
+                );
+            } else {
+                detail::co_sort_columns<std::size_t>(
+                    this->get(), keys, args_tuple, std::make_index_sequence<nb_columns>{},
+                    std::move(compare), std::move(projection)
+                );
+            }
+        }
+    };
+}}
+
+#endif // CPPSORT_UTILITY_CO_SORT_H_
@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_EXECUTOR_H_
+#define CPPSORT_UTILITY_EXECUTOR_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../detail/fork_join.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    ////////////////////////////////////////////////////////////
+    // Executors
+    //
+    // An executor is an object on which the parallel algorithms
+    // of the library run their tasks:
+    // - executor.submit(task) runs the nullary callable task at
+    //   some point, on any thread
+    // - executor.parallelism() returns the number of tasks that
+    //   the executor can run concurrently, used as the default
+    //   number of threads of parallel algorithms
+
+    namespace detail
+    {
+        template<typename T>
+        using submit_t = decltype(std::declval<T&>().submit(std::declval<std::function<void()>>()));
+
+        template<typename T>
+        using parallelism_t = decltype(std::declval<const T&>().parallelism());
+    }
+
+    template<typename T>
+    using is_executor = std::integral_constant<bool,
+        cppsort::detail::is_detected_v<detail::submit_t, T> &&
+        cppsort::detail::is_detected_v<detail::parallelism_t, T>
+    >;
+
+    template<typename T>
+    constexpr bool is_executor_v = is_executor<T>::value;
+
+    ////////////////////////////////////////////////////////////
+    // Work-stealing thread pool
+    //
+    // Every worker has its own queue of tasks: tasks submitted by
+    // a worker go to the back of its own queue, tasks submitted
+    // from other threads are spread over the queues. A worker
+    // takes the most recent task of its own queue, and steals the
+    // oldest task of another queue when its own is empty.
+    //
+    // Tasks must not throw. The destructor waits for every task
+    // that was submitted to finish. If no worker thread can be
+    // started, the tasks are run directly by submit.
+
+    class thread_pool
+    {
+        public:
+
+            ////////////////////////////////////////////////////////////
+            // Construction
+
+            explicit thread_pool(std::size_t nb_threads=cppsort::detail::default_parallelism())
+            {
+                queues.reserve(nb_threads);
+                for (std::size_t idx = 0; idx < nb_threads; ++idx) {
+                    queues.emplace_back(new worker_queue);
+                }
+                workers.reserve(nb_threads);
+                try {
+                    for (std::size_t idx = 0; idx < nb_threads; ++idx) {
+                        workers.emplace_back(&thread_pool::run_worker, this, idx);
+                    }
+                } catch (...) {
+                    // Not enough resources to start a new thread, use
+                    // the ones that could be started: they steal the
+                    // tasks of the queues without a worker
+                }
+            }
+
+            thread_pool(const thread_pool&) = delete;
+            thread_pool& operator=(const thread_pool&) = delete;
+
+            ~thread_pool()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    stopping = true;
+                }
+                wake.notify_all();
+                for (auto& worker: workers) {
+                    worker.join();
+                }
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Executor interface
+
+            template<typename Task>
+            auto submit(Task&& task)
+                -> void
+            {
+                if (workers.empty()) {
+                    task();
+                    return;
+                }
+
+                auto& current = current_worker();
+                auto idx = current.first == this ?
+                    current.second :
+                    next_queue++ % queues.size();
+                {
+                    // The task is counted before the queue is unlocked:
+                    // a worker can't pop it and decrement the counter
+                    // before it is incremented
+                    std::lock_guard<std::mutex> queue_lock(queues[idx]->mutex);
+                    queues[idx]->tasks.emplace_back(std::forward<Task>(task));
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ++nb_pending;
+                }
+                wake.notify_one();
+            }
+
+            auto parallelism() const noexcept
+                -> std::size_t
+            {
+                return workers.empty() ? 1 : workers.size();
+            }
+
+        private:
+
+            struct worker_queue
+            {
+                std::mutex mutex;
+                std::deque<std::function<void()>> tasks;
+            };
+
+            // Pool and index of the worker running on the current thread
+            static auto current_worker() noexcept
+                -> std::pair<const thread_pool*, std::size_t>&
+            {
+                thread_local std::pair<const thread_pool*, std::size_t> current(nullptr, 0);
+                return current;
+            }
+
+            auto try_pop(std::size_t idx, std::function<void()>& task)
+                -> bool
+            {
+                {
+                    auto& queue = *queues[idx];
+                    std::lock_guard<std::mutex> lock(queue.mutex);
+                    if (not queue.tasks.empty()) {
+                        task = std::move(queue.tasks.back());
+                        queue.tasks.pop_back();
+                        return true;
+                    }
+                }
+                for (std::size_t step = 1; step < queues.size(); ++step) {
+                    auto& queue = *queues[(idx + step) % queues.size()];
+                    std::lock_guard<std::mutex> lock(queue.mutex);
+                    if (not queue.tasks.empty()) {
+                        task = std::move(queue.tasks.front());
+                        queue.tasks.pop_front();
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            auto run_worker(std::size_t idx)
+                -> void
+            {
+                current_worker() = { this, idx };
+                std::function<void()> task;
+                for (;;) {
+                    if (try_pop(idx, task)) {
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            --nb_pending;
+                        }
+                        task();
+                        task = nullptr;
+                        continue;
+                    }
+
+                    std::unique_lock<std::mutex> lock(mutex);
+                    wake.wait(lock, [this] { return stopping || nb_pending > 0; });
+                    if (stopping && nb_pending == 0) {
+                        return;
+                    }
+                }
+            }
+
+            std::vector<std::unique_ptr<worker_queue>> queues;
+            std::vector<std::thread> workers;
+            std::atomic<std::size_t> next_queue{0};
+
+            // Number of tasks waiting in the queues
+            std::mutex mutex;
+            std::condition_variable wake;
+            std::size_t nb_pending = 0;
+            bool stopping = false;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Pool used by the parallel algorithms when they are not
+    // given an executor, started the first time it is needed
+
+    inline auto default_thread_pool()
+        -> thread_pool&
+    {
+        static thread_pool pool;
+        return pool;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Non-owning reference to any executor, or to the default
+    // thread pool when default-constructed: parallel sorters
+    // store one to know where to run their tasks
+
+    class executor_ref
+    {
+        public:
+
+            ////////////////////////////////////////////////////////////
+            // Construction
+
+            constexpr executor_ref() noexcept = default;
+
+            template<
+                typename Executor,
+                typename = cppsort::detail::enable_if_t<
+                    is_executor_v<Executor> &&
+                    not std::is_same<Executor, executor_ref>::value
+                >
+            >
+            executor_ref(Executor& executor) noexcept:
+                executor(&executor),
+                submit_func(&submit_to<Executor>),
+                parallelism_func(&parallelism_of<Executor>)
+            {}
+
+            ////////////////////////////////////////////////////////////
+            // Executor interface
+
+            template<typename Task>
+            auto submit(Task&& task) const
+                -> void
+            {
+                if (executor == nullptr) {
+                    default_thread_pool().submit(std::forward<Task>(task));
+                } else {
+                    submit_func(executor, std::function<void()>(std::forward<Task>(task)));
+                }
+            }
+
+            auto parallelism() const
+                -> std::size_t
+            {
+                if (executor == nullptr) {
+                    return cppsort::detail::default_parallelism();
+                }
+                return parallelism_func(executor);
+            }
+
+        private:
+
+            template<typename Executor>
+            static auto submit_to(void* executor, std::function<void()>&& task)
+                -> void
+            {
+                static_cast<Executor*>(executor)->submit(std::move(task));
+            }
+
+            template<typename Executor>
+            static auto parallelism_of(const void* executor)
+                -> std::size_t
+            {
+                return static_cast<const Executor*>(executor)->parallelism();
+            }
+
+            void* executor = nullptr;
+            void (*submit_func)(void*, std::function<void()>&&) = nullptr;
+            std::size_t (*parallelism_func)(const void*) = nullptr;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Call func(i) for every i in [0, nb_tasks) on the executor
+    // and wait for all of the calls to finish: the calling thread
+    // runs the calls that the executor didn't start, so the
+    // executor doesn't need to run the tasks concurrently
+
+    template<typename Executor, typename Func>
+    auto fork_join(Executor&& executor, std::size_t nb_tasks, Func func)
+        -> void
+    {
+        cppsort::detail::fork_join(executor, nb_tasks, std::move(func));
+    }
+}}
+
+#endif // CPPSORT_UTILITY_EXECUTOR_H_
@@ -0,0 +1,484 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_RESUMABLE_SORT_H_
+#define CPPSORT_UTILITY_RESUMABLE_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/iter_move.h>
+#include "../detail/iterator_traits.h"
+#include "../detail/memory.h"
+#include "../detail/move.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    ////////////////////////////////////////////////////////////
+    // Resumable sort
+    //
+    // Bottom-up stable merge sort whose state is kept between
+    // calls to resume, each of which performs a bounded amount
+    // of work: the collection is first split into small blocks
+    // sorted with insertion sort, then every pass merges pairs
+    // of adjacent runs, doubling the size of the runs until a
+    // single one is left. The smallest run of a merge is moved
+    // to a buffer, then merged back with the other run one
+    // element at a time, which allows to stop anywhere in a
+    // merge. The buffer holds half of the collection.
+    //
+    // The buffered run is only given back to the collection at
+    // the end of the merge: if the sort is destroyed before it
+    // completes, the buffered elements are moved back to the
+    // collection, which holds every one of its elements in an
+    // unspecified order. Every step performs its comparisons
+    // before moving elements, so a comparison that throws leaves
+    // the sort in the state it was in before the failed step,
+    // and resume can be called again.
+
+    template<
+        typename RandomAccessIterator,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity
+    >
+    class resumable_sort
+    {
+        public:
+
+            ////////////////////////////////////////////////////////////
+            // Member types
+
+            using iterator = RandomAccessIterator;
+            using difference_type = cppsort::detail::difference_type_t<RandomAccessIterator>;
+
+            ////////////////////////////////////////////////////////////
+            // Construction & destruction
+
+            resumable_sort(RandomAccessIterator first, RandomAccessIterator last,
+                           Compare compare={}, Projection projection={}):
+                first(first),
+                size(last - first),
+                compare(std::move(compare)),
+                projection(std::move(projection)),
+                buffer((size + 1) / 2)
+            {
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        cppsort::detail::iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "resumable_sort requires at least random-access iterators"
+                );
+
+                if (buffer.size() < (size + 1) / 2) {
+                    throw std::bad_alloc();
+                }
+                // Count the merge passes for progress()
+                for (auto width = block_size; width < size; width *= 2) {
+                    ++nb_passes;
+                }
+            }
+
+            resumable_sort(const resumable_sort&) = delete;
+            resumable_sort& operator=(const resumable_sort&) = delete;
+
+            resumable_sort(resumable_sort&& other):
+                first(std::move(other.first)),
+                size(other.size),
+                compare(std::move(other.compare)),
+                projection(std::move(other.projection)),
+                buffer(std::move(other.buffer)),
+                buffered(other.buffered),
+                phase(other.phase),
+                width(other.width),
+                low(other.low),
+                middle(other.middle),
+                high(other.high),
+                buffer_pos(other.buffer_pos),
+                other_pos(other.other_pos),
+                out_pos(other.out_pos),
+                backward(other.backward),
+                work_done(other.work_done),
+                nb_passes(other.nb_passes)
+            {
+                // The buffered elements now belong to this sort
+                other.buffered = 0;
+                other.phase = phase_done;
+            }
+
+            resumable_sort& operator=(resumable_sort&&) = delete;
+
+            ~resumable_sort()
+            {
+                // Give the elements of an unfinished merge back to
+                // the collection, they fill the hole it left
+                if (phase == phase_copy) {
+                    std::move(buffer.data(), buffer.data() + buffered,
+                              first + (backward ? middle : low));
+                } else if (phase == phase_merge) {
+                    if (backward) {
+                        std::move(buffer.data(), buffer.data() + buffer_pos,
+                                  first + other_pos);
+                    } else {
+                        std::move(buffer.data() + buffer_pos, buffer.data() + buffered,
+                                  first + out_pos);
+                    }
+                }
+                cppsort::detail::destroy_n(buffer.data(), buffered);
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Sorting
+
+            // Perform about max_steps elementary operations, returns
+            // whether the collection is sorted
+            auto resume(std::size_t max_steps)
+                -> bool
+            {
+                auto steps = static_cast<difference_type>(max_steps);
+                while (steps > 0 && not done()) {
+                    steps -= step(steps);
+                }
+                return done();
+            }
+
+            // Work until the collection is sorted or until the given
+            // duration has elapsed, returns whether it is sorted
+            template<typename Rep, typename Period>
+            auto resume_for(const std::chrono::duration<Rep, Period>& duration)
+                -> bool
+            {
+                auto deadline = std::chrono::steady_clock::now() + duration;
+                do {
+                    resume(steps_per_clock_check);
+                } while (not done() && std::chrono::steady_clock::now() < deadline);
+                return done();
+            }
+
+            // Sort what's left of the collection
+            auto finish()
+                -> void
+            {
+                while (not done()) {
+                    step(size);
+                }
+            }
+
+            ////////////////////////////////////////////////////////////
+            // State
+
+            auto done() const noexcept
+                -> bool
+            {
+                return phase == phase_done;
+            }
+
+            // Fraction of the work already done, between 0 and 1
+            auto progress() const noexcept
+                -> double
+            {
+                if (done()) {
+                    return 1.0;
+                }
+                auto total = static_cast<double>(size) * static_cast<double>(nb_passes + 1);
+                return static_cast<double>(work_done) / total;
+            }
+
+        private:
+
+            using rvalue_type = cppsort::detail::rvalue_type_t<RandomAccessIterator>;
+
+            // Size of the blocks sorted with insertion sort
+            static constexpr difference_type block_size = 32;
+            // Number of steps between two checks of the clock
+            static constexpr std::size_t steps_per_clock_check = 4096;
+
+            enum phase_t
+            {
+                phase_blocks,   // Sort the blocks
+                phase_next,     // Find the next pair of runs to merge
+                phase_copy,     // Move the smallest run to the buffer
+                phase_merge,    // Merge the buffer with the other run
+                phase_done
+            };
+
+            // Perform a single operation or a series of operations
+            // of the same kind and return their number, at most
+            // max_steps
+            auto step(difference_type max_steps)
+                -> difference_type
+            {
+                using utility::iter_move;
+                auto&& comp = utility::as_function(compare);
+                auto&& proj = utility::as_function(projection);
+
+                switch (phase) {
+                    case phase_blocks: {
+                        if (low >= size) {
+                            low = 0;
+                            width = block_size;
+                            phase = width < size ? phase_next : phase_done;
+                            return 0;
+                        }
+                        // middle is the next element of the block to insert
+                        // in its sorted prefix
+                        auto block_end = (std::min)(low + block_size, size);
+                        if (middle <= low) {
+                            middle = low + 1;
+                        }
+                        if (middle >= block_end) {
+                            work_done += block_end - low;
+                            low = block_end;
+                            return 1;
+                        }
+                        // Find the position of the element before moving
+                        // anything, so that a throwing comparison leaves
+                        // the block untouched
+                        auto it = first + middle;
+                        auto pos = it;
+                        while (pos != first + low && comp(proj(*it), proj(pos[-1]))) {
+                            --pos;
+                        }
+                        if (pos != it) {
+                            auto tmp = iter_move(it);
+                            cppsort::detail::move_backward(pos, it, it + 1);
+                            *pos = std::move(tmp);
+                        }
+                        ++middle;
+                        return 1;
+                    }
+
+                    case phase_next: {
+                        if (low + width >= size) {
+                            // The last run has no pair, the pass is over
+                            work_done += size - low;
+                            low = 0;
+                            width *= 2;
+                            if (width >= size) {
+                                phase = phase_done;
+                            }
+                            return 1;
+                        }
+                        middle = low + width;
+                        high = (std::min)(middle + width, size);
+                        if (not comp(proj(first[middle]), proj(first[middle - 1]))) {
+                            // The runs are already in order
+                            work_done += high - low;
+                            low = high;
+                            return 1;
+                        }
+                        // Buffer the smallest run
+                        backward = high - middle < middle - low;
+                        phase = phase_copy;
+                        return 1;
+                    }
+
+                    case phase_copy: {
+                        auto copy_first = backward ? middle : low;
+                        auto copy_size = backward ? high - middle : middle - low;
+                        auto nb_steps = (std::min)(max_steps, copy_size - buffered);
+                        auto ptr = buffer.data() + buffered;
+                        auto it = first + copy_first + buffered;
+                        for (auto count = nb_steps; count > 0; --count) {
+                            ::new (ptr) rvalue_type(iter_move(it));
+                            ++ptr;
+                            ++it;
+                            ++buffered;
+                        }
+                        if (buffered == copy_size) {
+                            if (backward) {
+                                buffer_pos = buffered;
+                                other_pos = middle;
+                                out_pos = high;
+                            } else {
+                                buffer_pos = 0;
+                                other_pos = middle;
+                                out_pos = low;
+                            }
+                            phase = phase_merge;
+                        }
+                        return nb_steps;
+                    }
+
+                    case phase_merge: {
+                        return backward ? merge_backward(max_steps) : merge_forward(max_steps);
+                    }
+
+                    default:
+                        return max_steps;
+                }
+            }
+
+            // Merge the left run, in the buffer, with the right run,
+            // from the front
+            auto merge_forward(difference_type max_steps)
+                -> difference_type
+            {
+                using utility::iter_move;
+                auto&& comp = utility::as_function(compare);
+                auto&& proj = utility::as_function(projection);
+
+                difference_type nb_steps = 0;
+                while (nb_steps < max_steps) {
+                    if (buffer_pos == buffered) {
+                        // The rest of the right run is already in place
+                        work_done += high - out_pos;
+                        end_merge();
+                        return nb_steps + 1;
+                    }
+                    if (other_pos == high) {
+                        // Move the rest of the left run
+                        auto count = (std::min)(max_steps - nb_steps, buffered - buffer_pos);
+                        std::move(buffer.data() + buffer_pos,
+                                  buffer.data() + buffer_pos + count,
+                                  first + out_pos);
+                        buffer_pos += count;
+                        out_pos += count;
+                        work_done += count;
+                        nb_steps += count;
+                        continue;
+                    }
+                    if (comp(proj(first[other_pos]), proj(buffer.data()[buffer_pos]))) {
+                        first[out_pos] = iter_move(first + other_pos);
+                        ++other_pos;
+                    } else {
+                        first[out_pos] = std::move(buffer.data()[buffer_pos]);
+                        ++buffer_pos;
+                    }
+                    ++out_pos;
+                    ++work_done;
+                    ++nb_steps;
+                }
+                return nb_steps;
+            }
+
+            // Merge the left run with the right run, in the buffer,
+            // from the back
+            auto merge_backward(difference_type max_steps)
+                -> difference_type
+            {
+                using utility::iter_move;
+                auto&& comp = utility::as_function(compare);
+                auto&& proj = utility::as_function(projection);
+
+                difference_type nb_steps = 0;
+                while (nb_steps < max_steps) {
+                    if (buffer_pos == 0) {
+                        // The rest of the left run is already in place
+                        work_done += out_pos - low;
+                        end_merge();
+                        return nb_steps + 1;
+                    }
+                    if (other_pos == low) {
+                        // Move the rest of the right run
+                        auto count = (std::min)(max_steps - nb_steps, buffer_pos);
+                        std::move(buffer.data() + buffer_pos - count,
+                                  buffer.data() + buffer_pos,
+                                  first + out_pos - count);
+                        buffer_pos -= count;
+                        out_pos -= count;
+                        work_done += count;
+                        nb_steps += count;
+                        continue;
+                    }
+                    if (comp(proj(buffer.data()[buffer_pos - 1]), proj(first[other_pos - 1]))) {
+                        first[out_pos - 1] = iter_move(first + (other_pos - 1));
+                        --other_pos;
+                    } else {
+                        first[out_pos - 1] = std::move(buffer.data()[buffer_pos - 1]);
+                        --buffer_pos;
+                    }
+                    --out_pos;
+                    ++work_done;
+                    ++nb_steps;
+                }
+                return nb_steps;
+            }
+
+            auto end_merge()
+                -> void
+            {
+                cppsort::detail::destroy_n(buffer.data(), buffered);
+                buffered = 0;
+                low = high;
+                phase = phase_next;
+            }
+
+            // Collection to sort
+            RandomAccessIterator first;
+            difference_type size;
+            Compare compare;
+            Projection projection;
+
+            // Buffer for the left run of a merge, holding buffered
+            // constructed elements
+            cppsort::detail::temporary_buffer<rvalue_type> buffer;
+            difference_type buffered = 0;
+
+            // Current step
+            phase_t phase = phase_blocks;
+            difference_type width = block_size;
+            difference_type low = 0;
+            difference_type middle = 0;
+            difference_type high = 0;
+            difference_type buffer_pos = 0;
+            difference_type other_pos = 0;
+            difference_type out_pos = 0;
+            // Whether the right run is buffered and merged from the back
+            bool backward = false;
+
+            // Measure of the progress of the sort
+            difference_type work_done = 0;
+            difference_type nb_passes = 0;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Creation functions
+
+    template<
+        typename RandomAccessIterator,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity,
+        typename = cppsort::detail::enable_if_t<
+            is_projection_iterator_v<Projection, RandomAccessIterator, Compare>
+        >
+    >
+    auto make_resumable_sort(RandomAccessIterator first, RandomAccessIterator last,
+                             Compare compare={}, Projection projection={})
+        -> resumable_sort<RandomAccessIterator, Compare, Projection>
+    {
+        return { std::move(first), std::move(last), std::move(compare), std::move(projection) };
+    }
+
+    template<
+        typename RandomAccessIterable,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity,
+        typename = cppsort::detail::enable_if_t<
+            is_projection_v<Projection, RandomAccessIterable, Compare>
+        >
+    >
+    auto make_resumable_sort(RandomAccessIterable& iterable,
+                             Compare compare={}, Projection projection={})
+        -> resumable_sort<decltype(std::begin(iterable)), Compare, Projection>
+    {
+        return { std::begin(iterable), std::end(iterable), std::move(compare), std::move(projection) };
+    }
+}}
+
+#endif // CPPSORT_UTILITY_RESUMABLE_SORT_H_
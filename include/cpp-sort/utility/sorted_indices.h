@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Morwenn
+ * Copyright (c) 2022-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_UTILITY_SORTED_INDICES_H_
@@ -8,8 +8,10 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <cstdint>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <numeric>
 #include <type_traits>
 #include <utility>
@@ -20,7 +22,9 @@
 #include <cpp-sort/utility/as_function.h>
 #include <cpp-sort/utility/functional.h>
 #include "../detail/checkers.h"
+#include "../detail/config.h"
 #include "../detail/iterator_traits.h"
+#include "../detail/keyed_value.h"
 #include "../detail/type_traits.h"
 
 namespace cppsort
@@ -29,7 +33,7 @@ namespace utility
 {
     namespace detail
     {
-        template<typename Sorter>
+        template<typename Sorter, typename IndexType>
         struct sorted_indices_impl:
             utility::adapter_storage<Sorter>,
             cppsort::detail::check_is_always_stable<Sorter>
@@ -40,6 +44,15 @@ namespace utility
                 utility::adapter_storage<Sorter>(std::move(sorter))
             {}
 
+            // Type of the indices, the difference type of the
+            // iterators by default
+            template<typename Iterator>
+            using index_type_t = cppsort::detail::conditional_t<
+                std::is_void<IndexType>::value,
+                cppsort::detail::difference_type_t<Iterator>,
+                IndexType
+            >;
+
             template<
                 typename RandomAccessIterator,
                 typename Compare = std::less<>,
@@ -50,7 +63,7 @@ namespace utility
             >
             auto operator()(RandomAccessIterator first, RandomAccessIterator last,
                             Compare compare={}, Projection projection={}) const
-                -> std::vector<cppsort::detail::difference_type_t<RandomAccessIterator>>
+                -> std::vector<index_type_t<RandomAccessIterator>>
             {
                 static_assert(
                     std::is_base_of<
@@ -60,38 +73,155 @@ namespace utility
                     "sorted_indices requires at least random-access iterators"
                 );
 
-                using difference_type = cppsort::detail::difference_type_t<RandomAccessIterator>;
-                auto&& proj = utility::as_function(projection);
+                // Create a vector of indices and fill it with the
+                // indices that would sort the array
+                std::vector<index_type_t<RandomAccessIterator>> indices(last - first);
+                sort_indices(first, last, indices.begin(),
+                             std::move(compare), std::move(projection));
+                return indices;
+            }
 
-                // Create a vector of indices
-                std::vector<difference_type> indices(last - first, 0);
-                std::iota(indices.begin(), indices.end(), 0);
+            ////////////////////////////////////////////////////////////
+            // Write the indices to a destination
 
-                // Reorder the vector thanks to the passed sorter
-                this->get()(indices, std::move(compare),
-                            [&first, &proj](difference_type index) -> auto& {
-                                return proj(first[index]);
-                            });
+            template<
+                typename RandomAccessIterator1,
+                typename RandomAccessIterator2,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = cppsort::detail::enable_if_t<is_projection_iterator_v<
+                    Projection, RandomAccessIterator1, Compare
+                >>
+            >
+            auto into(RandomAccessIterator1 first, RandomAccessIterator1 last,
+                      RandomAccessIterator2 result,
+                      Compare compare={}, Projection projection={}) const
+                -> RandomAccessIterator2
+            {
+                static_assert(
+                    std::is_base_of<
+                        iterator_category,
+                        cppsort::detail::iterator_category_t<RandomAccessIterator1>
+                    >::value,
+                    "sorted_indices requires at least random-access iterators"
+                );
 
-                // Return the indices that would sort the array
-                return indices;
+                return sort_indices(first, last, result, std::move(compare), std::move(projection));
+            }
+
+            template<
+                typename RandomAccessIterable,
+                typename RandomAccessIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = cppsort::detail::enable_if_t<is_projection_v<
+                    Projection, RandomAccessIterable, Compare
+                >>
+            >
+            auto into(RandomAccessIterable&& iterable, RandomAccessIterator result,
+                      Compare compare={}, Projection projection={}) const
+                -> RandomAccessIterator
+            {
+                return into(std::begin(iterable), std::end(iterable), result,
+                            std::move(compare), std::move(projection));
             }
 
             ////////////////////////////////////////////////////////////
             // Sorter traits
 
             using iterator_category = std::random_access_iterator_tag;
+
+        private:
+
+            template<typename RandomAccessIterator1, typename RandomAccessIterator2,
+                     typename Compare, typename Projection>
+            auto sort_indices(RandomAccessIterator1 first, RandomAccessIterator1 last,
+                              RandomAccessIterator2 result,
+                              Compare compare, Projection projection) const
+                -> RandomAccessIterator2
+            {
+                using index_type = cppsort::detail::value_type_t<RandomAccessIterator2>;
+                using key_type = cppsort::detail::projected_t<RandomAccessIterator1, Projection>;
+
+                // Make sure that every index can be represented
+                std::uintmax_t size = last - first;
+                std::uintmax_t max_index = (std::numeric_limits<index_type>::max)();
+                CPPSORT_ASSERT(size == 0 || size - 1 <= max_index);
+                (void)size;
+                (void)max_index;
+
+                return sort_indices(first, last, result, std::move(compare), std::move(projection),
+                                    std::is_arithmetic<key_type>{});
+            }
+
+            // Sort the indices with a projection reading the keys
+            // from the original collection
+            template<typename RandomAccessIterator1, typename RandomAccessIterator2,
+                     typename Compare, typename Projection>
+            auto sort_indices(RandomAccessIterator1 first, RandomAccessIterator1 last,
+                              RandomAccessIterator2 result,
+                              Compare compare, Projection projection,
+                              std::false_type) const
+                -> RandomAccessIterator2
+            {
+                using index_type = cppsort::detail::value_type_t<RandomAccessIterator2>;
+                auto&& proj = utility::as_function(projection);
+
+                auto result_last = result + (last - first);
+                std::iota(result, result_last, index_type{});
+
+                // Reorder the indices thanks to the passed sorter
+                this->get()(result, result_last, std::move(compare),
+                            [&first, &proj](index_type index) -> decltype(auto) {
+                                return proj(first[index]);
+                            });
+                return result_last;
+            }
+
+            // When the keys are arithmetic types, gather them next
+            // to their index and sort the pairs: the comparisons
+            // read contiguous memory instead of reaching for random
+            // elements of the collection, and radix sorters such as
+            // ska_sorter or spread_sorter can sort the keys directly
+            template<typename RandomAccessIterator1, typename RandomAccessIterator2,
+                     typename Compare, typename Projection>
+            auto sort_indices(RandomAccessIterator1 first, RandomAccessIterator1 last,
+                              RandomAccessIterator2 result,
+                              Compare compare, Projection projection,
+                              std::true_type) const
+                -> RandomAccessIterator2
+            {
+                using index_type = cppsort::detail::value_type_t<RandomAccessIterator2>;
+                using key_type = cppsort::detail::projected_t<RandomAccessIterator1, Projection>;
+                using pair_type = cppsort::detail::keyed_value<key_type, index_type>;
+                auto&& proj = utility::as_function(projection);
+
+                std::vector<pair_type> pairs;
+                pairs.reserve(last - first);
+                index_type index = 0;
+                for (auto it = first; it != last; ++it) {
+                    pairs.push_back(pair_type{ proj(*it), index });
+                    ++index;
+                }
+
+                this->get()(pairs, std::move(compare), &pair_type::key);
+                for (auto& pair: pairs) {
+                    *result = pair.value;
+                    ++result;
+                }
+                return result;
+            }
         };
     }
 
-    template<typename Sorter>
+    template<typename Sorter, typename IndexType=void>
     struct sorted_indices:
-        sorter_facade<detail::sorted_indices_impl<Sorter>>
+        sorter_facade<detail::sorted_indices_impl<Sorter, IndexType>>
     {
         sorted_indices() = default;
 
         constexpr explicit sorted_indices(Sorter sorter):
-            sorter_facade<detail::sorted_indices_impl<Sorter>>(std::move(sorter))
+            sorter_facade<detail::sorted_indices_impl<Sorter, IndexType>>(std::move(sorter))
         {}
     };
 }}
@@ -101,8 +231,8 @@ namespace cppsort
     ////////////////////////////////////////////////////////////
     // is_stable specialization
 
-    template<typename Sorter, typename... Args>
-    struct is_stable<cppsort::utility::sorted_indices<Sorter>(Args...)>:
+    template<typename Sorter, typename IndexType, typename... Args>
+    struct is_stable<cppsort::utility::sorted_indices<Sorter, IndexType>(Args...)>:
         is_stable<Sorter(Args...)>
     {};
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Morwenn
+ * Copyright (c) 2022-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_UTILITY_SORTED_ITERATORS_H_
@@ -8,6 +8,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <cstddef>
 #include <functional>
 #include <iterator>
 #include <type_traits>
@@ -16,10 +17,14 @@
 #include <cpp-sort/sorter_facade.h>
 #include <cpp-sort/sorter_traits.h>
 #include <cpp-sort/utility/adapter_storage.h>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/executor.h>
 #include <cpp-sort/utility/functional.h>
 #include <cpp-sort/utility/size.h>
 #include "../detail/checkers.h"
 #include "../detail/iterator_traits.h"
+#include "../detail/keyed_value.h"
+#include "../detail/parallel_merge_sort.h"
 #include "../detail/type_traits.h"
 
 namespace cppsort
@@ -28,43 +33,32 @@ namespace utility
 {
     namespace detail
     {
-        template<
-            typename Sorter,
-            typename Iterator,
-            typename Compare,
-            typename Projection
-        >
-        auto compute_sorted_iterators(Sorter&& sorter, Iterator first, Iterator last,
-                                      cppsort::detail::difference_type_t<Iterator> size,
-                                      Compare compare, Projection projection)
-            -> std::vector<Iterator>
-        {
-            // Copy the iterators in a vector
-            std::vector<Iterator> iterators;
-            iterators.reserve(size);
-            for (auto it = first; it != last; ++it) {
-                iterators.emplace_back(it);
-            }
-
-            // Sort the iterators on pointed values
-            std::forward<Sorter>(sorter)(iterators.begin(), iterators.end(),
-                                         std::move(compare),
-                                         utility::indirect{} | std::move(projection));
-
-            return iterators;
-        }
-
         template<typename Sorter>
         struct sorted_iterators_impl:
             utility::adapter_storage<Sorter>,
             cppsort::detail::check_is_always_stable<Sorter>
         {
+            // Maximal number of threads used to sort the iterators,
+            // 0 meaning as many threads as the executor can run
+            // concurrently: the iterators are sorted on the calling
+            // thread unless an executor is given
+            std::size_t max_threads = 1;
+            // Executor running the sorting tasks
+            utility::executor_ref executor;
+
             sorted_iterators_impl() = default;
 
             constexpr explicit sorted_iterators_impl(Sorter&& sorter):
                 utility::adapter_storage<Sorter>(std::move(sorter))
             {}
 
+            constexpr sorted_iterators_impl(Sorter&& sorter, utility::executor_ref executor,
+                                            std::size_t nb_threads):
+                utility::adapter_storage<Sorter>(std::move(sorter)),
+                max_threads(nb_threads),
+                executor(executor)
+            {}
+
             template<
                 typename ForwardIterable,
                 typename Compare = std::less<>,
@@ -75,6 +69,47 @@ namespace utility
             >
             auto operator()(ForwardIterable&& iterable, Compare compare={}, Projection projection={}) const
                 -> std::vector<cppsort::detail::remove_cvref_t<decltype(std::begin(iterable))>>
+            {
+                using iterator = cppsort::detail::remove_cvref_t<decltype(std::begin(iterable))>;
+                std::vector<iterator> iterators(cppsort::utility::size(iterable));
+                into(std::forward<ForwardIterable>(iterable), iterators.begin(),
+                     std::move(compare), std::move(projection));
+                return iterators;
+            }
+
+            template<
+                typename ForwardIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = cppsort::detail::enable_if_t<
+                    is_projection_iterator_v<Projection, ForwardIterator, Compare>
+                >
+            >
+            auto operator()(ForwardIterator first, ForwardIterator last,
+                            Compare compare={}, Projection projection={}) const
+                -> std::vector<ForwardIterator>
+            {
+                std::vector<ForwardIterator> iterators(std::distance(first, last));
+                into(std::move(first), std::move(last), iterators.begin(),
+                     std::move(compare), std::move(projection));
+                return iterators;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Write the iterators to a destination
+
+            template<
+                typename ForwardIterable,
+                typename RandomAccessIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = cppsort::detail::enable_if_t<
+                    is_projection_v<Projection, ForwardIterable, Compare>
+                >
+            >
+            auto into(ForwardIterable&& iterable, RandomAccessIterator result,
+                      Compare compare={}, Projection projection={}) const
+                -> RandomAccessIterator
             {
                 using category = cppsort::detail::iterator_category_t<decltype(std::begin(iterable))>;
                 static_assert(
@@ -83,21 +118,22 @@ namespace utility
                 );
 
                 auto dist = cppsort::utility::size(iterable);
-                return compute_sorted_iterators(this->get(), std::begin(iterable), std::end(iterable),
-                                                dist, std::move(compare), std::move(projection));
+                return sort_iterators(std::begin(iterable), std::end(iterable), dist, result,
+                                      std::move(compare), std::move(projection));
             }
 
             template<
                 typename ForwardIterator,
+                typename RandomAccessIterator,
                 typename Compare = std::less<>,
                 typename Projection = utility::identity,
                 typename = cppsort::detail::enable_if_t<
                     is_projection_iterator_v<Projection, ForwardIterator, Compare>
                 >
             >
-            auto operator()(ForwardIterator first, ForwardIterator last,
-                            Compare compare={}, Projection projection={}) const
-                -> std::vector<ForwardIterator>
+            auto into(ForwardIterator first, ForwardIterator last, RandomAccessIterator result,
+                      Compare compare={}, Projection projection={}) const
+                -> RandomAccessIterator
             {
                 using category = cppsort::detail::iterator_category_t<ForwardIterator>;
                 static_assert(
@@ -106,14 +142,96 @@ namespace utility
                 );
 
                 auto dist = std::distance(first, last);
-                return compute_sorted_iterators(this->get(), std::move(first), std::move(last),
-                                                dist, std::move(compare), std::move(projection));
+                return sort_iterators(std::move(first), std::move(last), dist, result,
+                                      std::move(compare), std::move(projection));
             }
 
             ////////////////////////////////////////////////////////////
             // Sorter traits
 
             using iterator_category = std::forward_iterator_tag;
+
+        private:
+
+            template<typename ForwardIterator, typename RandomAccessIterator,
+                     typename Compare, typename Projection>
+            auto sort_iterators(ForwardIterator first, ForwardIterator last,
+                                cppsort::detail::difference_type_t<ForwardIterator> size,
+                                RandomAccessIterator result,
+                                Compare compare, Projection projection) const
+                -> RandomAccessIterator
+            {
+                using key_type = cppsort::detail::projected_t<ForwardIterator, Projection>;
+                return sort_iterators(std::move(first), std::move(last), size, result,
+                                      std::move(compare), std::move(projection),
+                                      std::is_arithmetic<key_type>{});
+            }
+
+            // Sort the iterators on pointed values
+            template<typename ForwardIterator, typename RandomAccessIterator,
+                     typename Compare, typename Projection>
+            auto sort_iterators(ForwardIterator first, ForwardIterator last,
+                                cppsort::detail::difference_type_t<ForwardIterator> size,
+                                RandomAccessIterator result,
+                                Compare compare, Projection projection,
+                                std::false_type) const
+                -> RandomAccessIterator
+            {
+                auto out = result;
+                for (auto it = first; it != last; ++it) {
+                    *out = it;
+                    ++out;
+                }
+
+                sort(result, result + size, std::move(compare),
+                     utility::indirect{} | std::move(projection));
+                return out;
+            }
+
+            // When the keys are arithmetic types, gather them next
+            // to their iterator and sort the pairs: the comparisons
+            // read contiguous memory instead of dereferencing the
+            // iterators, and radix sorters can sort the keys directly
+            template<typename ForwardIterator, typename RandomAccessIterator,
+                     typename Compare, typename Projection>
+            auto sort_iterators(ForwardIterator first, ForwardIterator last,
+                                cppsort::detail::difference_type_t<ForwardIterator> size,
+                                RandomAccessIterator result,
+                                Compare compare, Projection projection,
+                                std::true_type) const
+                -> RandomAccessIterator
+            {
+                using key_type = cppsort::detail::projected_t<ForwardIterator, Projection>;
+                using pair_type = cppsort::detail::keyed_value<key_type, ForwardIterator>;
+                auto&& proj = utility::as_function(projection);
+
+                std::vector<pair_type> pairs;
+                pairs.reserve(size);
+                for (auto it = first; it != last; ++it) {
+                    pairs.push_back(pair_type{ proj(*it), it });
+                }
+
+                sort(pairs.begin(), pairs.end(), std::move(compare), &pair_type::key);
+                for (auto& pair: pairs) {
+                    *result = pair.value;
+                    ++result;
+                }
+                return result;
+            }
+
+            // Sort with the adapted sorter, in parallel when
+            // several threads are allowed
+            template<typename RandomAccessIterator, typename Compare, typename Projection>
+            auto sort(RandomAccessIterator first, RandomAccessIterator last,
+                      Compare compare, Projection projection) const
+                -> void
+            {
+                cppsort::detail::parallel_merge_sort(
+                    std::move(first), std::move(last),
+                    executor, cppsort::detail::parallelism(max_threads, executor),
+                    this->get(), std::move(compare), std::move(projection)
+                );
+            }
         };
     }
 
@@ -126,6 +244,13 @@ namespace utility
         constexpr explicit sorted_iterators(Sorter sorter):
             sorter_facade<detail::sorted_iterators_impl<Sorter>>(std::move(sorter))
         {}
+
+        constexpr sorted_iterators(Sorter sorter, utility::executor_ref executor,
+                                   std::size_t max_threads=0):
+            sorter_facade<detail::sorted_iterators_impl<Sorter>>(
+                std::move(sorter), executor, max_threads
+            )
+        {}
     };
 }}
 
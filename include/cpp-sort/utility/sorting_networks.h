@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Morwenn
+ * Copyright (c) 2021-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #ifndef CPPSORT_UTILITY_SORTING_NETWORKS_H_
@@ -13,6 +13,7 @@
 #include <functional>
 #include <utility>
 #include <cpp-sort/utility/functional.h>
+#include "../detail/make_array.h"
 #include "../detail/swap_if.h"
 
 namespace cppsort
@@ -30,6 +31,104 @@ namespace utility
         IndexType first, second;
     };
 
+    ////////////////////////////////////////////////////////////
+    // Comparator networks metrics
+    //
+    // The size of a network is its number of CEs, its depth is
+    // the number of steps needed to perform all its CEs when
+    // independent CEs are performed in parallel; computing the
+    // depth requires the number of inputs of the network
+
+    template<typename IndexType, std::size_t N>
+    constexpr auto network_size(const std::array<index_pair<IndexType>, N>&) noexcept
+        -> std::size_t
+    {
+        return N;
+    }
+
+    template<std::size_t Inputs, typename IndexType, std::size_t N>
+    constexpr auto network_depth(const std::array<index_pair<IndexType>, N>& index_pairs) noexcept
+        -> std::size_t
+    {
+        // Depth of the last CE performed on each input,
+        // extra element to avoid zero-sized arrays
+        std::size_t depths[Inputs + 1] = {};
+        std::size_t depth = 0;
+
+        for (std::size_t idx = 0; idx < N; ++idx) {
+            auto first = static_cast<std::size_t>(index_pairs[idx].first);
+            auto second = static_cast<std::size_t>(index_pairs[idx].second);
+            auto pair_depth = (depths[first] < depths[second] ? depths[second] : depths[first]) + 1;
+            depths[first] = pair_depth;
+            depths[second] = pair_depth;
+            if (depth < pair_depth) {
+                depth = pair_depth;
+            }
+        }
+        return depth;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Comparator networks layers
+    //
+    // CEs can be grouped in layers of independent CEs, each CE
+    // belonging to the layer right after the last layer of the
+    // CEs that use the same indices before it: the CEs of a
+    // given layer can be performed in any order, or in parallel
+
+    template<std::size_t Inputs, typename IndexType, std::size_t N>
+    constexpr auto network_layers(const std::array<index_pair<IndexType>, N>& index_pairs) noexcept
+        -> std::array<std::size_t, N>
+    {
+        std::size_t depths[Inputs + 1] = {};
+        std::size_t layers[N] = {};
+
+        for (std::size_t idx = 0; idx < N; ++idx) {
+            auto first = static_cast<std::size_t>(index_pairs[idx].first);
+            auto second = static_cast<std::size_t>(index_pairs[idx].second);
+            auto layer = depths[first] < depths[second] ? depths[second] : depths[first];
+            depths[first] = layer + 1;
+            depths[second] = layer + 1;
+            layers[idx] = layer;
+        }
+        return cppsort::detail::make_array(layers);
+    }
+
+    template<std::size_t Inputs, typename IndexType>
+    constexpr auto network_layers(const std::array<index_pair<IndexType>, 0>&) noexcept
+        -> std::array<std::size_t, 0>
+    {
+        return {};
+    }
+
+    template<std::size_t Inputs, typename IndexType, std::size_t N>
+    constexpr auto layered_index_pairs(const std::array<index_pair<IndexType>, N>& index_pairs) noexcept
+        -> std::array<index_pair<IndexType>, N>
+    {
+        // Stable reordering of the CEs by layer
+        const auto layers = network_layers<Inputs>(index_pairs);
+        auto depth = network_depth<Inputs>(index_pairs);
+
+        index_pair<IndexType> pairs[N] = {};
+        std::size_t current_pair_idx = 0;
+        for (std::size_t layer = 0; layer < depth; ++layer) {
+            for (std::size_t idx = 0; idx < N; ++idx) {
+                if (layers[idx] == layer) {
+                    pairs[current_pair_idx] = index_pairs[idx];
+                    ++current_pair_idx;
+                }
+            }
+        }
+        return cppsort::detail::make_array(pairs);
+    }
+
+    template<std::size_t Inputs, typename IndexType>
+    constexpr auto layered_index_pairs(const std::array<index_pair<IndexType>, 0>&) noexcept
+        -> std::array<index_pair<IndexType>, 0>
+    {
+        return {};
+    }
+
     ////////////////////////////////////////////////////////////
     // swap_index_pairs
     //
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_ZIP_VIEW_H_
+#define CPPSORT_UTILITY_ZIP_VIEW_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/utility/branchless_traits.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/iter_move.h>
+#include "../detail/config.h"
+#include "../detail/iterator_traits.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    ////////////////////////////////////////////////////////////
+    // Zip iterator
+    //
+    // Random-access iterator over several random-access ranges
+    // of the same size, such as the columns of a structure of
+    // arrays: dereferencing it returns a tuple of references to
+    // the elements at the same position in every range. Such a
+    // tuple is a proxy: assigning a tuple to it assigns the
+    // elements of the ranges, and comparing it with std::less<>
+    // compares the elements lexicographically.
+    //
+    // iter_move returns the value_type, a tuple of values, which
+    // is what the sorting algorithms use as temporaries, and
+    // iter_swap swaps the elements of every range in place
+    // without building a temporary tuple
+
+    template<typename... Iterators>
+    class zip_iterator
+    {
+        public:
+
+            ////////////////////////////////////////////////////////////
+            // Public types
+
+            using iterator_category = std::random_access_iterator_tag;
+            using iterator_type     = std::tuple<Iterators...>;
+            using value_type        = std::tuple<cppsort::detail::value_type_t<Iterators>...>;
+            using difference_type   = std::common_type_t<cppsort::detail::difference_type_t<Iterators>...>;
+            using pointer           = void;
+            using reference         = std::tuple<cppsort::detail::reference_t<Iterators>...>;
+
+            ////////////////////////////////////////////////////////////
+            // Constructors
+
+            zip_iterator() = default;
+
+            constexpr explicit zip_iterator(Iterators... its):
+                its(std::move(its)...)
+            {}
+
+            ////////////////////////////////////////////////////////////
+            // Members access
+
+            constexpr auto base() const
+                -> const iterator_type&
+            {
+                return its;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Element access
+
+            constexpr auto operator*() const
+                -> reference
+            {
+                return dereference(std::index_sequence_for<Iterators...>{});
+            }
+
+            constexpr auto operator[](difference_type pos) const
+                -> reference
+            {
+                return *(*this + pos);
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Increment/decrement operators
+
+            auto operator++()
+                -> zip_iterator&
+            {
+                return *this += 1;
+            }
+
+            auto operator++(int)
+                -> zip_iterator
+            {
+                auto tmp = *this;
+                operator++();
+                return tmp;
+            }
+
+            auto operator--()
+                -> zip_iterator&
+            {
+                return *this -= 1;
+            }
+
+            auto operator--(int)
+                -> zip_iterator
+            {
+                auto tmp = *this;
+                operator--();
+                return tmp;
+            }
+
+            auto operator+=(difference_type increment)
+                -> zip_iterator&
+            {
+                advance(increment, std::index_sequence_for<Iterators...>{});
+                return *this;
+            }
+
+            auto operator-=(difference_type increment)
+                -> zip_iterator&
+            {
+                return *this += -increment;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Comparison operators, the ranges move together so
+            // comparing the first iterators is enough
+
+            friend constexpr auto operator==(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> bool
+            {
+                return std::get<0>(lhs.its) == std::get<0>(rhs.its);
+            }
+
+            friend constexpr auto operator!=(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> bool
+            {
+                return std::get<0>(lhs.its) != std::get<0>(rhs.its);
+            }
+
+            friend constexpr auto operator<(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> bool
+            {
+                return std::get<0>(lhs.its) < std::get<0>(rhs.its);
+            }
+
+            friend constexpr auto operator<=(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> bool
+            {
+                return std::get<0>(lhs.its) <= std::get<0>(rhs.its);
+            }
+
+            friend constexpr auto operator>(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> bool
+            {
+                return std::get<0>(lhs.its) > std::get<0>(rhs.its);
+            }
+
+            friend constexpr auto operator>=(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> bool
+            {
+                return std::get<0>(lhs.its) >= std::get<0>(rhs.its);
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Arithmetic operators
+
+            friend auto operator+(zip_iterator it, difference_type size)
+                -> zip_iterator
+            {
+                return it += size;
+            }
+
+            friend auto operator+(difference_type size, zip_iterator it)
+                -> zip_iterator
+            {
+                return it += size;
+            }
+
+            friend auto operator-(zip_iterator it, difference_type size)
+                -> zip_iterator
+            {
+                return it -= size;
+            }
+
+            friend constexpr auto operator-(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> difference_type
+            {
+                return std::get<0>(lhs.its) - std::get<0>(rhs.its);
+            }
+
+            ////////////////////////////////////////////////////////////
+            // iter_move/iter_swap
+
+            friend auto iter_move(const zip_iterator& it)
+                -> value_type
+            {
+                return it.move_values(std::index_sequence_for<Iterators...>{});
+            }
+
+            friend auto iter_swap(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> void
+            {
+                lhs.swap_values(rhs, std::index_sequence_for<Iterators...>{});
+            }
+
+        private:
+
+            template<std::size_t... Indices>
+            constexpr auto dereference(std::index_sequence<Indices...>) const
+                -> reference
+            {
+                return reference(*std::get<Indices>(its)...);
+            }
+
+            template<std::size_t... Indices>
+            auto advance(difference_type increment, std::index_sequence<Indices...>)
+                -> void
+            {
+                (void)std::initializer_list<int>{
+                    (std::get<Indices>(its) += increment, 0)...
+                };
+            }
+
+            template<std::size_t... Indices>
+            auto move_values(std::index_sequence<Indices...>) const
+                -> value_type
+            {
+                using utility::iter_move;
+                return value_type(iter_move(std::get<Indices>(its))...);
+            }
+
+            template<std::size_t... Indices>
+            auto swap_values(const zip_iterator& other, std::index_sequence<Indices...>) const
+                -> void
+            {
+                using utility::iter_swap;
+                (void)std::initializer_list<int>{
+                    (iter_swap(std::get<Indices>(its), std::get<Indices>(other.its)), 0)...
+                };
+            }
+
+            iterator_type its;
+    };
+
+    template<typename... Iterators>
+    auto make_zip_iterator(Iterators... its)
+        -> zip_iterator<Iterators...>
+    {
+        return zip_iterator<Iterators...>(std::move(its)...);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Column projection
+    //
+    // Returns the Nth element of a tuple, which is as cheap as
+    // accessing a data member: unlike a lambda calling std::get,
+    // it allows pdq_sorter to use its branchless partitioning
+
+    template<std::size_t N>
+    struct get_column:
+        projection_base
+    {
+        template<typename Tuple>
+        constexpr auto operator()(Tuple&& value) const noexcept
+            -> decltype(std::get<N>(std::forward<Tuple>(value)))
+        {
+            return std::get<N>(std::forward<Tuple>(value));
+        }
+    };
+
+    template<std::size_t N, typename T>
+    struct is_probably_branchless_projection<get_column<N>, T>:
+        std::true_type
+    {};
+
+    ////////////////////////////////////////////////////////////
+    // Zip view
+    //
+    // Range of zip iterators over several random-access ranges
+    // of the same size, which can be passed to sorters
+
+    template<typename... Iterators>
+    class zip_view
+    {
+        public:
+
+            using iterator = zip_iterator<Iterators...>;
+
+            zip_view() = default;
+
+            constexpr zip_view(iterator first, iterator last):
+                first(std::move(first)),
+                last(std::move(last))
+            {}
+
+            constexpr auto begin() const
+                -> iterator
+            {
+                return first;
+            }
+
+            constexpr auto end() const
+                -> iterator
+            {
+                return last;
+            }
+
+            constexpr auto size() const
+                -> std::size_t
+            {
+                return static_cast<std::size_t>(last - first);
+            }
+
+        private:
+
+            iterator first;
+            iterator last;
+    };
+
+    template<typename RandomAccessIterable, typename... RandomAccessIterables>
+    auto zip(RandomAccessIterable& iterable, RandomAccessIterables&... iterables)
+        -> zip_view<
+            decltype(std::begin(iterable)),
+            decltype(std::begin(iterables))...
+        >
+    {
+        auto size = std::end(iterable) - std::begin(iterable);
+        using sizes_t = std::initializer_list<decltype(size)>;
+        for (auto other_size: sizes_t{ (std::end(iterables) - std::begin(iterables))... }) {
+            CPPSORT_ASSERT(other_size == size);
+            (void)other_size;
+        }
+
+        return {
+            make_zip_iterator(std::begin(iterable), std::begin(iterables)...),
+            make_zip_iterator(std::begin(iterable) + size, std::begin(iterables) + size...)
+        };
+    }
+}}
+
+#endif // CPPSORT_UTILITY_ZIP_VIEW_H_
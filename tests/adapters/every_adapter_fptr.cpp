@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022 Morwenn
+ * Copyright (c) 2018-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #include <algorithm>
@@ -7,6 +7,7 @@
 #include <functional>
 #include <iterator>
 #include <list>
+#include <type_traits>
 #include <vector>
 #include <catch2/catch_test_macros.hpp>
 #include <cpp-sort/adapters.h>
@@ -98,6 +99,28 @@ TEST_CASE( "function pointer test for every adapter",
         CHECK( std::is_sorted(fli.begin(), fli.end(), std::greater<>{}) );
     }
 
+    SECTION( "par_adapter" )
+    {
+        // The thread count and the executor are state: the
+        // adapter is not convertible to a function pointer
+        using sorter = cppsort::par_adapter<
+            cppsort::poplar_sorter
+        >;
+        using fptr_t = void(*)(std::vector<short int>&, std::greater<>);
+        STATIC_CHECK( not std::is_convertible<sorter, fptr_t>::value );
+    }
+
+    SECTION( "record_adapter" )
+    {
+        using sorter = cppsort::record_adapter<
+            cppsort::poplar_sorter
+        >;
+        constexpr void(*sort_it)(std::vector<short int>&, std::greater<>) = sorter{};
+
+        sort_it(collection, std::greater<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+    }
+
     SECTION( "schwartz_adapter" )
     {
         using sorter = cppsort::schwartz_adapter<
@@ -177,6 +200,22 @@ TEST_CASE( "function pointer test for every adapter",
         CHECK( std::is_sorted(to_sort.begin(), to_sort.end(), std::greater<>{}) );
     }
 
+    SECTION( "small_sort_adapter" )
+    {
+        using sorter = cppsort::small_sort_adapter<
+            cppsort::low_comparisons_sorter,
+            cppsort::poplar_sorter
+        >;
+        constexpr void(*sort_it)(std::vector<short int>&, std::greater<>) = sorter{};
+
+        sort_it(collection, std::greater<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+
+        std::vector<short int> small = { 5, 2, 8, 7, 1, 6 };
+        sort_it(small, std::greater<>{});
+        CHECK( std::is_sorted(small.begin(), small.end(), std::greater<>{}) );
+    }
+
     SECTION( "stable_adapter" )
     {
         using sorter = cppsort::stable_adapter<
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022 Morwenn
+ * Copyright (c) 2019-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #include <algorithm>
@@ -146,6 +146,24 @@ TEST_CASE( "test stateful sorters with every adapter",
         CHECK( std::is_sorted(fli.begin(), fli.end(), std::greater<>{}) );
     }
 
+    SECTION( "par_adapter" )
+    {
+        stateful_sorter<> sorter(42);
+        cppsort::par_adapter<stateful_sorter<>> sort_it(sorter);
+
+        sort_it(collection, std::greater<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+    }
+
+    SECTION( "record_adapter" )
+    {
+        stateful_sorter<> sorter(42);
+        cppsort::record_adapter<stateful_sorter<>> sort_it(sorter);
+
+        sort_it(collection, std::greater<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+    }
+
     SECTION( "schwartz_adapter" )
     {
         stateful_sorter<> sorter(42);
@@ -167,6 +185,18 @@ TEST_CASE( "test stateful sorters with every adapter",
         CHECK( std::is_sorted(li.begin(), li.end(), std::greater<>{}) );
     }
 
+    SECTION( "small_sort_adapter" )
+    {
+        stateful_sorter<> sorter(42);
+        cppsort::small_sort_adapter<
+            cppsort::low_comparisons_sorter,
+            stateful_sorter<>
+        > sort_it(sorter);
+
+        sort_it(collection, std::greater<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+    }
+
     SECTION( "stable_adapter<self_sort_adapter>" )
     {
         stateful_sorter<> sorter(42);
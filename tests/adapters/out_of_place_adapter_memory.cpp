@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <catch2/catch_test_macros.hpp>
+#include <cpp-sort/adapters/out_of_place_adapter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/sorters/ska_sorter.h>
+#include <cpp-sort/utility/buffer.h>
+#include <testing-tools/distributions.h>
+
+TEST_CASE( "out_of_place_adapter with memory providers", "[out_of_place_adapter]" )
+{
+    auto distribution = dist::shuffled{};
+
+    SECTION( "default thread-local memory" )
+    {
+        cppsort::out_of_place_adapter<cppsort::ska_sorter> sorter;
+        for (int size : { 1000, 200, 3000 }) {
+            std::list<int> collection;
+            distribution(std::back_inserter(collection), size, -500);
+            sorter(collection);
+            CHECK( std::is_sorted(collection.begin(), collection.end()) );
+        }
+    }
+
+    SECTION( "heap memory" )
+    {
+        cppsort::out_of_place_adapter<cppsort::pdq_sorter, cppsort::utility::heap_memory> sorter;
+        std::deque<int> collection;
+        distribution(std::back_inserter(collection), 1000, -500);
+        sorter(collection, std::greater<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+    }
+
+    SECTION( "nested out_of_place_adapter" )
+    {
+        // The inner adapter can't use the memory held by the outer
+        // one and must get its own
+        cppsort::out_of_place_adapter<
+            cppsort::out_of_place_adapter<cppsort::pdq_sorter>
+        > sorter;
+        std::list<int> collection;
+        distribution(std::back_inserter(collection), 1000, -500);
+        sorter(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+}
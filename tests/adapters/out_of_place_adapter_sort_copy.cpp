@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <cpp-sort/adapters/out_of_place_adapter.h>
+#include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/ska_sorter.h>
+#include <testing-tools/algorithm.h>
+#include <testing-tools/distributions.h>
+#include <testing-tools/wrapper.h>
+
+TEST_CASE( "out_of_place_adapter::sort_copy", "[out_of_place_adapter]" )
+{
+    std::list<int> collection;
+    auto distribution = dist::shuffled{};
+    distribution(std::back_inserter(collection), 500, -250);
+    const std::list<int> original = collection;
+
+    SECTION( "sort into a random-access range" )
+    {
+        std::vector<int> result(collection.size());
+        auto sorter = cppsort::out_of_place_adapter<cppsort::ska_sorter>{};
+        auto last = sorter.sort_copy(collection, result.begin());
+        CHECK( last == result.end() );
+        CHECK( std::is_sorted(result.begin(), result.end()) );
+        CHECK( collection == original );
+    }
+
+    SECTION( "sort into an output iterator" )
+    {
+        std::vector<int> result;
+        auto sorter = cppsort::out_of_place_adapter<cppsort::ska_sorter>{};
+        sorter.sort_copy(collection.begin(), collection.end(), std::back_inserter(result));
+        CHECK( result.size() == collection.size() );
+        CHECK( std::is_sorted(result.begin(), result.end()) );
+        CHECK( collection == original );
+    }
+
+    SECTION( "sort into a bidirectional range" )
+    {
+        // merge_sorter handles bidirectional iterators, so the
+        // elements are sorted directly in the destination
+        std::list<int> result(collection.size());
+        auto sorter = cppsort::out_of_place_adapter<cppsort::merge_sorter>{};
+        auto last = sorter.sort_copy(collection, result.begin(), std::greater<>{});
+        CHECK( last == result.end() );
+        CHECK( std::is_sorted(result.begin(), result.end(), std::greater<>{}) );
+        CHECK( collection == original );
+    }
+
+    SECTION( "sort with a projection" )
+    {
+        std::vector<generic_wrapper<int>> input(collection.begin(), collection.end());
+        std::list<generic_wrapper<int>> result(input.size(), generic_wrapper<int>(0));
+        auto sorter = cppsort::out_of_place_adapter<cppsort::ska_sorter>{};
+        sorter.sort_copy(input.begin(), input.end(), result.begin(), &generic_wrapper<int>::value);
+        CHECK( helpers::is_sorted(result.begin(), result.end(),
+                                  std::less<>{}, &generic_wrapper<int>::value) );
+    }
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cpp-sort/adapters/par_adapter.h>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/sorters.h>
+#include <cpp-sort/sorters/ips4o_sorter.h>
+#include <cpp-sort/utility/executor.h>
+#include <cpp-sort/utility/functional.h>
+#include <testing-tools/algorithm.h>
+#include <testing-tools/distributions.h>
+#include <testing-tools/wrapper.h>
+
+namespace
+{
+    // Stable sorter counting how many times it sorted a chunk
+    // of the collection to completion
+    struct counting_sorter_impl
+    {
+        std::atomic<int>* nb_calls = nullptr;
+
+        template<
+            typename RandomAccessIterator,
+            typename Compare = std::less<>,
+            typename Projection = cppsort::utility::identity,
+            typename = std::enable_if_t<cppsort::is_projection_iterator_v<
+                Projection, RandomAccessIterator, Compare
+            >>
+        >
+        auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                        Compare compare={}, Projection projection={}) const
+            -> void
+        {
+            cppsort::merge_sort(first, last, compare, projection);
+            ++*nb_calls;
+        }
+
+        using iterator_category = std::random_access_iterator_tag;
+        using is_always_stable = std::true_type;
+    };
+
+    struct counting_sorter:
+        cppsort::sorter_facade<counting_sorter_impl>
+    {
+        explicit counting_sorter(std::atomic<int>& nb_calls):
+            cppsort::sorter_facade<counting_sorter_impl>(counting_sorter_impl{ &nb_calls })
+        {}
+    };
+}
+
+TEMPLATE_TEST_CASE( "every random-access sorter with par_adapter", "[par_adapter]",
+                    cppsort::adaptive_shivers_sorter,
+                    cppsort::grail_sorter<>,
+                    cppsort::heap_sorter,
+                    cppsort::ips4o_sorter,
+                    cppsort::merge_sorter,
+                    cppsort::pdq_sorter,
+                    cppsort::poplar_sorter,
+                    cppsort::quick_merge_sorter,
+                    cppsort::quick_sorter,
+                    cppsort::ska_sorter,
+                    cppsort::smooth_sorter,
+                    cppsort::spin_sorter,
+                    cppsort::spread_sorter,
+                    cppsort::std_sorter,
+                    cppsort::tim_sorter )
+{
+    std::vector<int> collection;
+    collection.reserve(100'000);
+    auto distribution = dist::shuffled{};
+    distribution(std::back_inserter(collection), 100'000);
+
+    cppsort::par_adapter<TestType> sorter(TestType{}, 4);
+    sorter(collection);
+    CHECK( std::is_sorted(collection.begin(), collection.end()) );
+}
+
+TEST_CASE( "par_adapter tests", "[par_adapter]" )
+{
+    using wrapper = generic_stable_wrapper<int>;
+
+    SECTION( "stability" )
+    {
+        std::vector<wrapper> collection(100'000);
+        helpers::iota(collection.begin(), collection.end(), 0, &wrapper::order);
+        auto distribution = dist::shuffled_16_values{};
+        distribution(collection.begin(), collection.size());
+
+        // Every chunk is sorted by its own call to the sorter
+        std::atomic<int> nb_calls(0);
+        cppsort::par_adapter<counting_sorter> sorter(counting_sorter(nb_calls), 5);
+        sorter(collection, &wrapper::value);
+        CHECK( nb_calls == 5 );
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "is_stable" )
+    {
+        using stable_sorter = cppsort::par_adapter<cppsort::merge_sorter>;
+        using unstable_sorter = cppsort::par_adapter<cppsort::pdq_sorter>;
+        STATIC_CHECK( cppsort::is_always_stable_v<stable_sorter> );
+        STATIC_CHECK( cppsort::is_stable_v<stable_sorter(std::vector<int>&)> );
+        STATIC_CHECK( not cppsort::is_always_stable_v<unstable_sorter> );
+        STATIC_CHECK( not cppsort::is_stable_v<unstable_sorter(std::vector<int>&)> );
+        STATIC_CHECK( cppsort::is_parallel_v<stable_sorter> );
+    }
+
+    SECTION( "custom executor and comparison" )
+    {
+        std::vector<int> collection;
+        collection.reserve(100'000);
+        auto distribution = dist::shuffled{};
+        distribution(std::back_inserter(collection), 100'000);
+
+        cppsort::utility::thread_pool pool(2);
+        cppsort::par_adapter<cppsort::pdq_sorter> sorter(cppsort::pdq_sorter{}, pool, 3);
+        sorter(collection, std::greater<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+    }
+
+    SECTION( "small collections" )
+    {
+        std::vector<int> collection = { 5, 8, 3, 2, 9, 1, 0, 4, 7, 6 };
+        cppsort::par_adapter<cppsort::pdq_sorter> sorter;
+        sorter(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "throwing comparison" )
+    {
+        const int size = 100'000;
+        std::vector<int> collection;
+        collection.reserve(size);
+        auto distribution = dist::shuffled{};
+        distribution(std::back_inserter(collection), size, 0);
+
+        // Throw during the merge: only count the comparisons
+        // performed once every chunk is sorted
+        std::atomic<int> nb_calls(0);
+        std::atomic<int> count(0);
+        std::atomic<int> max_count(0);
+        auto compare = [&](int lhs, int rhs) {
+            if (nb_calls == 4 && ++count == max_count) {
+                throw std::runtime_error("comparison threw");
+            }
+            return lhs < rhs;
+        };
+        cppsort::par_adapter<counting_sorter> sorter(counting_sorter(nb_calls), 4);
+        auto copy = collection;
+        max_count = -1;
+        sorter(copy, compare);
+        REQUIRE( nb_calls == 4 );
+        auto nb_comparisons = count.load();
+
+        nb_calls = 0;
+        count = 0;
+        max_count = nb_comparisons - 1'000;
+        CHECK_THROWS_AS( sorter(collection, compare), std::runtime_error );
+
+        std::sort(collection.begin(), collection.end());
+        std::vector<int> expected(size);
+        helpers::iota(expected.begin(), expected.end(), 0);
+        CHECK( collection == expected );
+    }
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <cpp-sort/adapters/record_adapter.h>
+#include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/sorters/ska_sorter.h>
+#include <testing-tools/algorithm.h>
+#include <testing-tools/distributions.h>
+
+namespace
+{
+    // Number of times a record was moved
+    std::size_t moves_count = 0;
+
+    // Large record with a small key, counting its moves
+    struct record
+    {
+        int key = 0;
+        int order = 0;
+        std::array<int, 50> payload = {};
+
+        record() = default;
+
+        record(int key, int order):
+            key(key),
+            order(order)
+        {
+            payload.fill(key);
+        }
+
+        record(const record&) = delete;
+        auto operator=(const record&) -> record& = delete;
+
+        record(record&& other) noexcept:
+            key(other.key),
+            order(other.order),
+            payload(other.payload)
+        {
+            ++moves_count;
+        }
+
+        auto operator=(record&& other) noexcept
+            -> record&
+        {
+            key = other.key;
+            order = other.order;
+            payload = other.payload;
+            ++moves_count;
+            return *this;
+        }
+    };
+}
+
+TEST_CASE( "record_adapter tests", "[record_adapter]" )
+{
+    std::vector<int> keys;
+    auto distribution = dist::shuffled_16_values{};
+    distribution(std::back_inserter(keys), 1000);
+
+    std::vector<record> collection;
+    collection.reserve(keys.size());
+    for (std::size_t idx = 0; idx < keys.size(); ++idx) {
+        collection.emplace_back(keys[idx], static_cast<int>(idx));
+    }
+    moves_count = 0;
+
+    auto check_records = [&] {
+        bool consistent = true;
+        for (const auto& rec: collection) {
+            consistent = consistent
+                && keys[rec.order] == rec.key
+                && std::all_of(rec.payload.begin(), rec.payload.end(),
+                               [&rec](int value) { return value == rec.key; });
+        }
+        CHECK( consistent );
+    };
+
+    SECTION( "stable comparison sorter" )
+    {
+        cppsort::record_adapter<cppsort::merge_sorter> sorter;
+        sorter(collection, &record::key);
+        CHECK( helpers::is_sorted(collection.begin(), collection.end(),
+                                  std::less<>{}, &record::key) );
+        check_records();
+        // Every record is moved to a buffer and back
+        CHECK( moves_count == 2 * collection.size() );
+
+        bool stable = true;
+        for (std::size_t idx = 1; idx < collection.size(); ++idx) {
+            if (collection[idx - 1].key == collection[idx].key) {
+                stable = stable && collection[idx - 1].order < collection[idx].order;
+            }
+        }
+        CHECK( stable );
+    }
+
+    SECTION( "comparison and projection" )
+    {
+        cppsort::record_adapter<cppsort::pdq_sorter> sorter;
+        sorter(collection.begin(), collection.end(), std::greater<>{}, &record::key);
+        CHECK( helpers::is_sorted(collection.begin(), collection.end(),
+                                  std::greater<>{}, &record::key) );
+        check_records();
+        CHECK( moves_count == 2 * collection.size() );
+    }
+
+    SECTION( "radix sorter" )
+    {
+        cppsort::record_adapter<cppsort::ska_sorter> sorter;
+        sorter(collection, &record::key);
+        CHECK( helpers::is_sorted(collection.begin(), collection.end(),
+                                  std::less<>{}, &record::key) );
+        check_records();
+        CHECK( moves_count == 2 * collection.size() );
+    }
+
+    SECTION( "non-arithmetic keys" )
+    {
+        auto to_string = [](const record& rec) { return std::to_string(rec.key); };
+        cppsort::record_adapter<cppsort::pdq_sorter> sorter;
+        sorter(collection, to_string);
+        CHECK( helpers::is_sorted(collection.begin(), collection.end(),
+                                  std::less<>{}, to_string) );
+        check_records();
+        CHECK( moves_count == 2 * collection.size() );
+    }
+
+    SECTION( "small collections are sorted directly" )
+    {
+        collection.erase(collection.begin() + 10, collection.end());
+        moves_count = 0;
+
+        cppsort::record_adapter<cppsort::merge_sorter> sorter;
+        sorter(collection, &record::key);
+        CHECK( helpers::is_sorted(collection.begin(), collection.end(),
+                                  std::less<>{}, &record::key) );
+        check_records();
+    }
+
+    SECTION( "small records are sorted directly" )
+    {
+        cppsort::record_adapter<cppsort::pdq_sorter> sorter;
+        sorter(keys);
+        CHECK( std::is_sorted(keys.begin(), keys.end()) );
+    }
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <cpp-sort/adapters/small_sort_adapter.h>
+#include <cpp-sort/fixed/low_comparisons_sorter.h>
+#include <cpp-sort/fixed/sorting_network_sorter.h>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/utility/functional.h>
+#include <testing-tools/distributions.h>
+#include <testing-tools/wrapper.h>
+
+namespace
+{
+    template<std::size_t N>
+    struct size_reporter_impl
+    {
+        template<
+            typename RandomAccessIterator,
+            typename Compare = std::less<>,
+            typename Projection = cppsort::utility::identity
+        >
+        auto operator()(RandomAccessIterator first, RandomAccessIterator,
+                        Compare={}, Projection={}) const
+            -> void
+        {
+            *first = N;
+        }
+    };
+
+    template<std::size_t N>
+    struct size_reporter:
+        cppsort::sorter_facade<size_reporter_impl<N>>
+    {};
+
+    struct fallback_sorter_impl
+    {
+        template<
+            typename RandomAccessIterator,
+            typename Compare = std::less<>,
+            typename Projection = cppsort::utility::identity
+        >
+        auto operator()(RandomAccessIterator first, RandomAccessIterator,
+                        Compare={}, Projection={}) const
+            -> void
+        {
+            *first = -1;
+        }
+
+        using iterator_category = std::random_access_iterator_tag;
+    };
+
+    struct fallback_sorter:
+        cppsort::sorter_facade<fallback_sorter_impl>
+    {};
+}
+
+namespace cppsort
+{
+    template<>
+    struct fixed_sorter_traits<size_reporter>
+    {
+        using domain = std::index_sequence<2, 3, 5, 8>;
+        using iterator_category = std::random_access_iterator_tag;
+    };
+}
+
+TEST_CASE( "small_sort_adapter dispatch",
+           "[small_sort_adapter]" )
+{
+    cppsort::small_sort_adapter<size_reporter, fallback_sorter> sorter;
+
+    SECTION( "sizes in the domain" )
+    {
+        for (int size: { 2, 3, 5, 8 }) {
+            std::vector<int> vec(size, 0);
+            sorter(vec);
+            CHECK( vec[0] == size );
+        }
+    }
+
+    SECTION( "sizes outside of the domain" )
+    {
+        for (int size: { 1, 4, 6, 7, 9, 50 }) {
+            std::vector<int> vec(size, 0);
+            sorter(vec);
+            CHECK( vec[0] == -1 );
+        }
+    }
+
+    SECTION( "explicit indices" )
+    {
+        cppsort::small_sort_adapter<
+            size_reporter,
+            fallback_sorter,
+            std::index_sequence<4>
+        > sorter2;
+
+        std::vector<int> vec(4, 0);
+        sorter2(vec);
+        CHECK( vec[0] == 4 );
+        std::vector<int> vec2(5, 0);
+        sorter2(vec2);
+        CHECK( vec2[0] == -1 );
+    }
+}
+
+TEST_CASE( "small_sort_adapter with library fixed-size sorters",
+           "[small_sort_adapter]" )
+{
+    std::vector<int> collection;
+    collection.reserve(70);
+    auto distribution = dist::shuffled{};
+    distribution.call<int>(std::back_inserter(collection), 70);
+
+    SECTION( "sorting_network_sorter" )
+    {
+        cppsort::small_sort_adapter<
+            cppsort::sorting_network_sorter,
+            cppsort::pdq_sorter
+        > sorter;
+
+        for (int size = 0; size <= 70; ++size) {
+            std::vector<int> vec = collection;
+            sorter(vec.begin(), vec.begin() + size);
+            CHECK( std::is_sorted(vec.begin(), vec.begin() + size) );
+        }
+    }
+
+    SECTION( "low_comparisons_sorter with projection" )
+    {
+        using wrapper = generic_wrapper<int>;
+
+        cppsort::small_sort_adapter<
+            cppsort::low_comparisons_sorter,
+            cppsort::pdq_sorter
+        > sorter;
+
+        for (int size = 0; size <= 20; ++size) {
+            std::vector<wrapper> vec(collection.begin(), collection.begin() + size);
+            sorter(vec, std::greater<>{}, &wrapper::value);
+            CHECK( std::is_sorted(vec.begin(), vec.end(), [](const wrapper& lhs, const wrapper& rhs) {
+                return lhs.value > rhs.value;
+            }) );
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022 Morwenn
+ * Copyright (c) 2017-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #include <algorithm>
@@ -10,6 +10,10 @@
 #include <vector>
 #include <catch2/catch_template_test_macros.hpp>
 #include <cpp-sort/sorters.h>
+#include <cpp-sort/sorters/ips2ra_sorter.h>
+#include <cpp-sort/sorters/ips4o_sorter.h>
+#include <cpp-sort/sorters/parallel_sample_sorter.h>
+#include <cpp-sort/sorters/parallel_spread_sorter.h>
 #include <cpp-sort/utility/buffer.h>
 #include <cpp-sort/utility/functional.h>
 #include <testing-tools/distributions.h>
@@ -33,9 +37,13 @@ TEMPLATE_TEST_CASE( "test random-access sorters with shuffled distribution", "[d
                     >,
                     cppsort::heap_sorter,
                     cppsort::insertion_sorter,
+                    cppsort::ips2ra_sorter,
+                    cppsort::ips4o_sorter,
                     cppsort::mel_sorter,
                     cppsort::merge_sorter,
                     cppsort::merge_insertion_sorter,
+                    cppsort::parallel_sample_sorter<>,
+                    cppsort::parallel_spread_sorter,
                     cppsort::pdq_sorter,
                     cppsort::poplar_sorter,
                     cppsort::quick_merge_sorter,
@@ -1,13 +1,21 @@
 /*
- * Copyright (c) 2016-2022 Morwenn
+ * Copyright (c) 2016-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
+#include <algorithm>
 #include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <utility>
 #include <vector>
 #include <catch2/catch_test_macros.hpp>
 #include <cpp-sort/probes/dis.h>
+#include <cpp-sort/probes/parallel_dis.h>
 #include <cpp-sort/utility/size.h>
+#include <testing-tools/distributions.h>
 #include <testing-tools/internal_compare.h>
+#include <testing-tools/wrapper.h>
 
 TEST_CASE( "presortedness measure: dis", "[probe][dis]" )
 {
@@ -58,4 +66,86 @@ TEST_CASE( "presortedness measure: dis", "[probe][dis]" )
         CHECK( dis(li) == max_n );
         CHECK( dis(li.begin(), li.end()) == max_n );
     }
+
+    SECTION( "same result for every iterator category" )
+    {
+        std::vector<int> collection;
+        collection.reserve(1000);
+        auto distribution = dist::shuffled_16_values{};
+        distribution(std::back_inserter(collection), 1000);
+
+        auto expected = dis(collection);
+        std::list<int> li(collection.begin(), collection.end());
+        CHECK( dis(li) == expected );
+        std::forward_list<int> fli(collection.begin(), collection.end());
+        CHECK( dis(fli) == expected );
+    }
+}
+
+TEST_CASE( "presortedness measure: parallel_dis", "[probe][dis]" )
+{
+    const int size = 300'000;
+    cppsort::probe::parallel_dis par_dis(4);
+
+    SECTION( "roughly sorted collection" )
+    {
+        // Elements are at most 5000 positions away from their
+        // sorted position, across the chunk boundaries
+        std::vector<int> collection(size);
+        for (int i = 0; i < size; ++i) {
+            collection[i] = i;
+        }
+        for (auto it = collection.begin(); it != collection.end(); it += 5000) {
+            std::reverse(it, it + 5000);
+        }
+        std::reverse(collection.begin() + 74'000, collection.begin() + 76'000);
+
+        auto expected = cppsort::probe::dis(collection);
+        CHECK( par_dis(collection) == expected );
+        CHECK( par_dis(collection.begin(), collection.end()) == expected );
+    }
+
+    SECTION( "with a comparison and a projection" )
+    {
+        using wrapper = generic_wrapper<int>;
+        std::vector<wrapper> collection(size);
+        auto distribution = dist::shuffled_16_values{};
+        distribution(collection.begin(), collection.size());
+        std::sort(collection.begin(), collection.begin() + 150'000,
+                  [](const wrapper& lhs, const wrapper& rhs) { return lhs.value > rhs.value; });
+
+        auto expected = cppsort::probe::dis(collection, std::greater<>{}, &wrapper::value);
+        CHECK( par_dis(collection, std::greater<>{}, &wrapper::value) == expected );
+    }
+
+    SECTION( "sorted and reversed collections" )
+    {
+        std::vector<int> collection(size);
+        for (int i = 0; i < size; ++i) {
+            collection[i] = i / 3;
+        }
+        CHECK( par_dis(collection) == 0 );
+        std::reverse(collection.begin(), collection.end());
+        CHECK( par_dis(collection) == cppsort::probe::dis(collection) );
+    }
+
+    SECTION( "inversion between the first and last chunks" )
+    {
+        // The carries have to cross every chunk
+        std::vector<int> collection(size);
+        for (int i = 0; i < size; ++i) {
+            collection[i] = i;
+        }
+        std::swap(collection.front(), collection.back());
+        CHECK( par_dis(collection) == size - 1 );
+        std::swap(collection[1], collection[size - 2]);
+        std::swap(collection.front(), collection.back());
+        CHECK( par_dis(collection) == size - 3 );
+    }
+
+    SECTION( "fallback for non-random-access iterators" )
+    {
+        std::list<int> li = { 47, 53, 46, 41, 59, 81, 74, 97, 100, 45 };
+        CHECK( par_dis(li) == 9 );
+    }
 }
@@ -1,15 +1,22 @@
 /*
- * Copyright (c) 2016-2022 Morwenn
+ * Copyright (c) 2016-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
+#include <algorithm>
 #include <forward_list>
+#include <functional>
 #include <iterator>
+#include <list>
+#include <utility>
 #include <vector>
 #include <catch2/catch_test_macros.hpp>
 #include <cpp-sort/probes/max.h>
+#include <cpp-sort/probes/parallel_max.h>
+#include <cpp-sort/probes/sorted_ranks.h>
 #include <cpp-sort/utility/size.h>
 #include <testing-tools/distributions.h>
 #include <testing-tools/internal_compare.h>
+#include <testing-tools/wrapper.h>
 
 TEST_CASE( "presortedness measure: max", "[probe][max]" )
 {
@@ -46,4 +53,74 @@ TEST_CASE( "presortedness measure: max", "[probe][max]" )
 
         CHECK( (max)(collection) == 0 );
     }
+
+    SECTION( "sorted ranks" )
+    {
+        std::vector<int> collection;
+        collection.reserve(1000);
+        auto distribution = dist::shuffled_16_values{};
+        distribution(std::back_inserter(collection), 1000);
+
+        auto ranks = cppsort::probe::compute_sorted_ranks(collection);
+        auto expected = (max)(collection);
+        CHECK( (max)(ranks) == expected );
+        std::forward_list<int> fli(collection.begin(), collection.end());
+        CHECK( (max)(fli) == expected );
+    }
+}
+
+TEST_CASE( "presortedness measure: parallel_max", "[probe][max]" )
+{
+    const int size = 300'000;
+    cppsort::probe::parallel_max par_max(4);
+
+    SECTION( "roughly sorted collection" )
+    {
+        std::vector<int> collection(size);
+        for (int i = 0; i < size; ++i) {
+            collection[i] = i;
+        }
+        for (auto it = collection.begin(); it != collection.end(); it += 5000) {
+            std::reverse(it, it + 5000);
+        }
+        std::reverse(collection.begin() + 74'000, collection.begin() + 76'000);
+
+        auto expected = (cppsort::probe::max)(collection);
+        CHECK( par_max(collection) == expected );
+        CHECK( par_max(collection.begin(), collection.end()) == expected );
+    }
+
+    SECTION( "long runs of equivalent elements" )
+    {
+        // Runs of equivalent elements span several chunks
+        using wrapper = generic_wrapper<int>;
+        std::vector<wrapper> collection(size);
+        auto distribution = dist::shuffled_16_values{};
+        distribution(collection.begin(), collection.size());
+
+        auto expected = (cppsort::probe::max)(collection, std::greater<>{}, &wrapper::value);
+        CHECK( par_max(collection, std::greater<>{}, &wrapper::value) == expected );
+
+        std::vector<int> values(size);
+        distribution(values.begin(), values.size());
+        CHECK( par_max(values) == (cppsort::probe::max)(values) );
+    }
+
+    SECTION( "run of equivalent elements spanning every chunk" )
+    {
+        // The elements at both ends belong to the other end of a
+        // run which starts in the first chunk and ends in the last
+        std::vector<long long> collection(size, 0);
+        collection.front() = 1;
+        collection.back() = -1;
+        CHECK( par_max(collection) == size - 1 );
+        std::swap(collection.front(), collection.back());
+        CHECK( par_max(collection, std::greater<>{}) == size - 1 );
+    }
+
+    SECTION( "fallback for non-random-access iterators" )
+    {
+        std::list<int> li = { 12, 28, 17, 59, 13, 10, 39, 21, 31, 30 };
+        CHECK( par_max(li) == 6 );
+    }
 }
@@ -1,12 +1,16 @@
 /*
- * Copyright (c) 2016-2022 Morwenn
+ * Copyright (c) 2016-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
 #include <vector>
 #include <catch2/catch_test_macros.hpp>
 #include <cpp-sort/probes/osc.h>
 #include <cpp-sort/utility/size.h>
+#include <testing-tools/distributions.h>
 #include <testing-tools/internal_compare.h>
 #include <testing-tools/wrapper.h>
 
@@ -49,4 +53,18 @@ TEST_CASE( "presortedness measure: osc", "[probe][osc]" )
         };
         CHECK( osc(vec, comp, &wrapper::value) == 17 );
     }
+
+    SECTION( "same result as the quadratic algorithm" )
+    {
+        // Few distinct values to exercise the handling of
+        // equivalent elements
+        std::list<int> li;
+        auto distribution = dist::shuffled_16_values{};
+        distribution(std::back_inserter(li), 300);
+        auto expected = cppsort::probe::detail::inplace_osc_algo(
+            li.begin(), li.end(), cppsort::utility::size(li),
+            std::less<>{}, cppsort::utility::identity{}
+        );
+        CHECK( osc(li) == expected );
+    }
 }
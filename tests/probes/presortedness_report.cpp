@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <functional>
+#include <iterator>
+#include <list>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <cpp-sort/probes.h>
+#include <cpp-sort/probes/presortedness_report.h>
+#include <testing-tools/distributions.h>
+#include <testing-tools/wrapper.h>
+
+TEST_CASE( "presortedness_report", "[probe][presortedness_report]" )
+{
+    using namespace cppsort;
+
+    SECTION( "same values as the individual probes" )
+    {
+        std::list<int> collection;
+        auto distribution = dist::shuffled{};
+        distribution(std::back_inserter(collection), 1000);
+
+        auto report = probe::presortedness_report(collection);
+        CHECK( report.block == probe::block(collection) );
+        CHECK( report.dis == probe::dis(collection) );
+        CHECK( report.enc == probe::enc(collection) );
+        CHECK( report.exc == probe::exc(collection) );
+        CHECK( report.ham == probe::ham(collection) );
+        CHECK( report.inv == probe::inv(collection) );
+        CHECK( report.max == probe::max(collection) );
+        CHECK( report.mono == probe::mono(collection) );
+        CHECK( report.osc == probe::osc(collection) );
+        CHECK( report.rem == probe::rem(collection) );
+        CHECK( report.runs == probe::runs(collection) );
+        CHECK( report.sus == probe::sus(collection) );
+    }
+
+    SECTION( "equivalent elements, comparison and projection" )
+    {
+        using wrapper = generic_wrapper<int>;
+        std::vector<wrapper> collection(1000);
+        auto distribution = dist::shuffled_16_values{};
+        distribution(collection.begin(), collection.size());
+
+        auto report = probe::presortedness_report(collection.begin(), collection.end(),
+                                                  std::greater<>{}, &wrapper::value);
+        auto probe_value = [&](const auto& probe) {
+            return probe(collection.begin(), collection.end(),
+                         std::greater<>{}, &wrapper::value);
+        };
+        CHECK( report.dis == probe_value(probe::dis) );
+        CHECK( report.enc == probe_value(probe::enc) );
+        CHECK( report.exc == probe_value(probe::exc) );
+        CHECK( report.ham == probe_value(probe::ham) );
+        CHECK( report.inv == probe_value(probe::inv) );
+        CHECK( report.max == probe_value(probe::max) );
+        CHECK( report.mono == probe_value(probe::mono) );
+        CHECK( report.osc == probe_value(probe::osc) );
+        CHECK( report.rem == probe_value(probe::rem) );
+        CHECK( report.runs == probe_value(probe::runs) );
+        CHECK( report.sus == probe_value(probe::sus) );
+    }
+
+    SECTION( "same values for several distributions" )
+    {
+        auto check_report = [](auto distribution) {
+            std::vector<int> collection;
+            distribution(std::back_inserter(collection), 1000);
+
+            auto report = probe::presortedness_report(collection);
+            CHECK( report.dis == probe::dis(collection) );
+            CHECK( report.enc == probe::enc(collection) );
+            CHECK( report.inv == probe::inv(collection) );
+            CHECK( report.mono == probe::mono(collection) );
+            CHECK( report.rem == probe::rem(collection) );
+            CHECK( report.runs == probe::runs(collection) );
+            CHECK( report.sus == probe::sus(collection) );
+        };
+        check_report(dist::all_equal{});
+        check_report(dist::descending{});
+        check_report(dist::ascending_duplicates{});
+        check_report(dist::pipe_organ{});
+        check_report(dist::push_front{});
+        check_report(dist::push_middle{});
+        check_report(dist::ascending_sawtooth{});
+        check_report(dist::descending_sawtooth{});
+        check_report(dist::alternating{});
+        check_report(dist::descending_plateau{});
+        check_report(dist::inversions(0.05));
+    }
+
+    SECTION( "sorted and small collections" )
+    {
+        std::vector<int> sorted = { 0, 1, 1, 2, 3, 5, 8, 13 };
+        auto report = probe::presortedness_report(sorted);
+        CHECK( report.block == 0 );
+        CHECK( report.dis == 0 );
+        CHECK( report.enc == 0 );
+        CHECK( report.exc == 0 );
+        CHECK( report.ham == 0 );
+        CHECK( report.inv == 0 );
+        CHECK( report.max == 0 );
+        CHECK( report.mono == 0 );
+        CHECK( report.osc == 0 );
+        CHECK( report.rem == 0 );
+        CHECK( report.runs == 0 );
+        CHECK( report.sus == 0 );
+
+        std::vector<int> one = { 42 };
+        CHECK( probe::presortedness_report(one).inv == 0 );
+    }
+}
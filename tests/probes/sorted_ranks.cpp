@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <cpp-sort/probes/exc.h>
+#include <cpp-sort/probes/ham.h>
+#include <cpp-sort/probes/sorted_ranks.h>
+#include <testing-tools/distributions.h>
+
+TEST_CASE( "sorted ranks of a collection", "[probe][sorted_ranks]" )
+{
+    using namespace cppsort;
+
+    SECTION( "simple test" )
+    {
+        std::forward_list<int> li = { 3, 1, 4, 1, 5 };
+        auto ranks = probe::compute_sorted_ranks(li);
+        CHECK( ranks.rank == std::vector<std::ptrdiff_t>{ 2, 0, 3, 0, 4 } );
+        CHECK( ranks.rank_end == std::vector<std::ptrdiff_t>{ 3, 2, 4, 2, 5 } );
+        CHECK( ranks.order == std::vector<std::ptrdiff_t>{ 1, 3, 0, 2, 4 } );
+    }
+
+    SECTION( "radix sort and comparison sort give the same ranks" )
+    {
+        std::vector<int> collection;
+        auto distribution = dist::shuffled_16_values{};
+        distribution(std::back_inserter(collection), 500);
+        std::vector<std::string> strings;
+        for (int value: collection) {
+            strings.push_back(std::to_string(value + 10));
+        }
+
+        auto radix_ranks = probe::compute_sorted_ranks(strings);
+        auto comparison_ranks = probe::compute_sorted_ranks(strings, [](const auto& lhs, const auto& rhs) {
+            return lhs < rhs;
+        });
+        CHECK( radix_ranks.rank == comparison_ranks.rank );
+        CHECK( radix_ranks.rank_end == comparison_ranks.rank_end );
+        CHECK( radix_ranks.order == comparison_ranks.order );
+    }
+
+    SECTION( "probes reusing the ranks" )
+    {
+        std::vector<int> collection;
+        auto distribution = dist::shuffled_16_values{};
+        distribution(std::back_inserter(collection), 500);
+
+        auto ranks = probe::compute_sorted_ranks(collection, std::greater<>{});
+        CHECK( probe::exc(ranks) == probe::exc(collection, std::greater<>{}) );
+        CHECK( probe::ham(ranks) == probe::ham(collection, std::greater<>{}) );
+    }
+}
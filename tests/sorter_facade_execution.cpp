@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <cpp-sort/execution.h>
+#include <cpp-sort/probes/dis.h>
+#include <cpp-sort/probes/parallel_dis.h>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/sorters/ips4o_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <testing-tools/distributions.h>
+#include <testing-tools/wrapper.h>
+
+#ifdef CPPSORT_TEST_STD_EXECUTION
+#   include <cpp-sort/std_execution.h>
+#endif
+
+namespace
+{
+    // Returns the number of threads it would have used
+
+    struct parallel_sorter_impl
+    {
+        std::size_t max_threads = 0;
+
+        parallel_sorter_impl() = default;
+
+        constexpr explicit parallel_sorter_impl(std::size_t nb_threads) noexcept:
+            max_threads(nb_threads)
+        {}
+
+        template<typename Iterator, typename Compare=std::less<>>
+        auto operator()(Iterator first, Iterator last, Compare compare={}) const
+            -> std::size_t
+        {
+            std::sort(first, last, compare);
+            return max_threads;
+        }
+
+        using is_parallel = std::true_type;
+    };
+
+    struct parallel_sorter:
+        cppsort::sorter_facade<parallel_sorter_impl>
+    {
+        parallel_sorter() = default;
+
+        constexpr explicit parallel_sorter(std::size_t max_threads) noexcept:
+            cppsort::sorter_facade<parallel_sorter_impl>(max_threads)
+        {}
+    };
+}
+
+TEST_CASE( "sorter_facade with execution policies", "[sorter_facade][execution]" )
+{
+    SECTION( "execution policy traits" )
+    {
+        STATIC_CHECK( cppsort::is_execution_policy_v<cppsort::execution::sequenced_policy> );
+        STATIC_CHECK( cppsort::is_execution_policy_v<cppsort::execution::parallel_policy> );
+        STATIC_CHECK( cppsort::is_execution_policy_v<cppsort::execution::parallel_unsequenced_policy> );
+        STATIC_CHECK( not cppsort::is_execution_policy_v<std::vector<int>> );
+        STATIC_CHECK( not cppsort::is_execution_policy_v<std::less<>> );
+
+        STATIC_CHECK( cppsort::is_parallel_v<parallel_sorter> );
+        STATIC_CHECK( cppsort::is_parallel_v<cppsort::ips4o_sorter> );
+        STATIC_CHECK( cppsort::is_parallel_v<cppsort::probe::parallel_dis> );
+        STATIC_CHECK( not cppsort::is_parallel_v<cppsort::pdq_sorter> );
+    }
+
+    SECTION( "parallel sorter" )
+    {
+        std::vector<int> collection = { 5, 8, 3, 2, 9, 1, 0, 4, 7, 6 };
+        parallel_sorter sorter(6);
+
+        CHECK( sorter(cppsort::execution::seq, collection) == 1 );
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+
+        // The limit of the sorter is used when the policy has none
+        CHECK( sorter(cppsort::execution::par, collection, std::greater<>{}) == 6 );
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+        CHECK( sorter(cppsort::execution::par_unseq, collection.begin(), collection.end()) == 6 );
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+
+        auto policy = cppsort::execution::parallel_policy(3);
+        CHECK( sorter(policy, collection.begin(), collection.end(), std::greater<>{}) == 3 );
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+    }
+
+    SECTION( "sequential fallback" )
+    {
+        using wrapper = generic_wrapper<int>;
+        std::vector<wrapper> collection(100);
+        auto distribution = dist::shuffled{};
+        distribution(collection.begin(), collection.size());
+
+        cppsort::pdq_sorter sorter;
+        sorter(cppsort::execution::par, collection, std::greater<>{}, &wrapper::value);
+        CHECK( std::is_sorted(collection.begin(), collection.end(),
+                              [](const wrapper& lhs, const wrapper& rhs) {
+                                  return lhs.value > rhs.value;
+                              }) );
+        sorter(cppsort::execution::seq, collection.begin(), collection.end(), &wrapper::value);
+        CHECK( std::is_sorted(collection.begin(), collection.end(),
+                              [](const wrapper& lhs, const wrapper& rhs) {
+                                  return lhs.value < rhs.value;
+                              }) );
+    }
+
+#ifdef CPPSORT_TEST_STD_EXECUTION
+    SECTION( "standard library execution policies" )
+    {
+        STATIC_CHECK( cppsort::is_execution_policy_v<std::execution::parallel_policy> );
+
+        std::vector<int> collection = { 5, 8, 3, 2, 9, 1, 0, 4, 7, 6 };
+        parallel_sorter sorter(6);
+        CHECK( sorter(std::execution::seq, collection) == 1 );
+        CHECK( sorter(std::execution::par, collection) == 6 );
+        CHECK( sorter(std::execution::par_unseq, collection) == 6 );
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+#endif
+
+    SECTION( "library parallel sorters and probes" )
+    {
+        std::vector<int> collection;
+        collection.reserve(100'000);
+        auto distribution = dist::shuffled{};
+        distribution(std::back_inserter(collection), 100'000);
+
+        auto dis = cppsort::probe::dis(collection);
+        CHECK( cppsort::probe::parallel_dis{}(cppsort::execution::parallel_policy(2), collection) == dis );
+        CHECK( cppsort::probe::parallel_dis{}(cppsort::execution::seq, collection) == dis );
+
+        cppsort::ips4o_sort(cppsort::execution::parallel_policy(2), collection, std::greater<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+        cppsort::ips4o_sort(cppsort::execution::seq, collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+}
@@ -9,6 +9,10 @@
 #include <vector>
 #include <catch2/catch_test_macros.hpp>
 #include <cpp-sort/sorters.h>
+#include <cpp-sort/sorters/ips2ra_sorter.h>
+#include <cpp-sort/sorters/ips4o_sorter.h>
+#include <cpp-sort/sorters/parallel_sample_sorter.h>
+#include <cpp-sort/sorters/parallel_spread_sorter.h>
 #include <testing-tools/distributions.h>
 
 TEST_CASE( "test every instantiated sorter", "[sorters]" )
@@ -76,6 +80,18 @@ TEST_CASE( "test every instantiated sorter", "[sorters]" )
         CHECK( std::is_sorted(collection.begin(), collection.end()) );
     }
 
+    SECTION( "ips2ra_sorter" )
+    {
+        cppsort::ips2ra_sort(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "ips4o_sorter" )
+    {
+        cppsort::ips4o_sort(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
     SECTION( "mel_sorter" )
     {
         cppsort::mel_sort(collection);
@@ -94,6 +110,18 @@ TEST_CASE( "test every instantiated sorter", "[sorters]" )
         CHECK( std::is_sorted(collection.begin(), collection.end()) );
     }
 
+    SECTION( "parallel_sample_sorter" )
+    {
+        cppsort::parallel_sample_sort(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "parallel_spread_sorter" )
+    {
+        cppsort::parallel_spread_sort(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
     SECTION( "pdq_sorter" )
     {
         cppsort::pdq_sort(collection);
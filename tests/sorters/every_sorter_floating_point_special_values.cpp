@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <vector>
+#include <catch2/catch_template_test_macros.hpp>
+#include <cpp-sort/fixed/sorting_network_sorter.h>
+#include <cpp-sort/sorters.h>
+#include <testing-tools/random.h>
+
+namespace
+{
+    auto count_negative_zeros(const std::vector<double>& collection)
+        -> long
+    {
+        return std::count_if(collection.begin(), collection.end(), [](double value) {
+            return value == 0.0 && std::signbit(value);
+        });
+    }
+}
+
+TEMPLATE_TEST_CASE( "test every sorter with floating point special values", "[sorters]",
+                    cppsort::adaptive_shivers_sorter,
+                    cppsort::cartesian_tree_sorter,
+                    cppsort::d_ary_heap_sorter<5>,
+                    cppsort::drop_merge_sorter,
+                    cppsort::grail_sorter<>,
+                    cppsort::heap_sorter,
+                    cppsort::insertion_sorter,
+                    cppsort::mel_sorter,
+                    cppsort::merge_insertion_sorter,
+                    cppsort::merge_sorter,
+                    cppsort::pdq_sorter,
+                    cppsort::poplar_sorter,
+                    cppsort::quick_merge_sorter,
+                    cppsort::quick_sorter,
+                    cppsort::selection_sorter,
+                    cppsort::ska_sorter,
+                    cppsort::slab_sorter,
+                    cppsort::smooth_sorter,
+                    cppsort::spin_sorter,
+                    cppsort::splay_sorter,
+                    cppsort::split_sorter,
+                    cppsort::spread_sorter,
+                    cppsort::std_sorter,
+                    cppsort::tim_sorter,
+                    cppsort::verge_sorter,
+                    cppsort::wiki_sorter<> )
+{
+    // Infinities are used as padding values by some algorithms,
+    // and equivalent values such as -0.0 and 0.0 must never be
+    // duplicated by conditional swaps
+
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> collection;
+    for (int i = 0 ; i < 150 ; ++i) {
+        collection.push_back(inf);
+        collection.push_back(-inf);
+        collection.push_back(-0.0);
+        collection.push_back(0.0);
+        collection.push_back(i % 50 - 25);
+    }
+    std::shuffle(collection.begin(), collection.end(), hasard::engine());
+    auto negative_zeros = count_negative_zeros(collection);
+
+    TestType sorter;
+    sorter(collection);
+    CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    CHECK( count_negative_zeros(collection) == negative_zeros );
+
+    std::shuffle(collection.begin(), collection.end(), hasard::engine());
+    sorter(collection, std::negate<>{});
+    CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+    CHECK( count_negative_zeros(collection) == negative_zeros );
+}
+
+TEST_CASE( "sorting_network_sorter with signed zeros", "[sorting_network_sorter]" )
+{
+    double collection[] = { 0.0, -0.0, -0.0, 0.0, 0.0, -0.0 };
+    cppsort::sorting_network_sorter<6>{}(collection);
+    CHECK( std::count_if(std::begin(collection), std::end(collection), [](double value) {
+        return std::signbit(value);
+    }) == 3 );
+}
@@ -9,6 +9,9 @@
 #include <vector>
 #include <catch2/catch_template_test_macros.hpp>
 #include <cpp-sort/sorters.h>
+#include <cpp-sort/sorters/ips2ra_sorter.h>
+#include <cpp-sort/sorters/ips4o_sorter.h>
+#include <cpp-sort/sorters/parallel_sample_sorter.h>
 #include <testing-tools/distributions.h>
 #include <testing-tools/memory_exhaustion.h>
 
@@ -24,7 +27,10 @@ TEMPLATE_TEST_CASE( "heap exhaustion for random-access sorters", "[sorters][heap
                     cppsort::grail_sorter<>,
                     cppsort::heap_sorter,
                     cppsort::insertion_sorter,
+                    cppsort::ips2ra_sorter,
+                    cppsort::ips4o_sorter,
                     cppsort::merge_sorter,
+                    cppsort::parallel_sample_sorter<cppsort::merge_sorter>,
                     cppsort::pdq_sorter,
                     cppsort::quick_merge_sorter,
                     cppsort::quick_sorter,
@@ -47,6 +53,25 @@ TEMPLATE_TEST_CASE( "heap exhaustion for random-access sorters", "[sorters][heap
     CHECK( std::is_sorted(collection.begin(), collection.end()) );
 }
 
+TEMPLATE_TEST_CASE( "heap exhaustion for parallel sorters", "[sorters][heap_exhaustion]",
+                    cppsort::ips2ra_sorter,
+                    cppsort::ips4o_sorter,
+                    cppsort::parallel_sample_sorter<cppsort::merge_sorter> )
+{
+    // Big enough for the parallel algorithms, which fall
+    // back to a sequential one without extra memory
+    std::vector<int> collection; collection.reserve(100'000);
+    auto distribution = dist::shuffled{};
+    distribution(std::back_inserter(collection), 100'000, -125);
+
+    TestType sorter(4);
+    {
+        scoped_memory_exhaustion _;
+        sorter(collection);
+    }
+    CHECK( std::is_sorted(collection.begin(), collection.end()) );
+}
+
 TEMPLATE_TEST_CASE( "heap exhaustion for bidirectional sorters", "[sorters][heap_exhaustion]",
                     cppsort::insertion_sorter,
                     cppsort::merge_sorter,
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <cpp-sort/sorters/ips2ra_sorter.h>
+#include <testing-tools/algorithm.h>
+#include <testing-tools/distributions.h>
+#include <testing-tools/random.h>
+
+TEST_CASE( "ips2ra_sorter tests", "[ips2ra_sorter]" )
+{
+    const int size = 300'000;
+    auto distribution = dist::shuffled{};
+
+    SECTION( "sort signed integers" )
+    {
+        std::vector<int> collection;
+        collection.reserve(size);
+        distribution(std::back_inserter(collection), size, -150'000);
+        cppsort::ips2ra_sorter(4)(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "sort unsigned integers with a wide range" )
+    {
+        std::vector<std::uint64_t> collection;
+        collection.reserve(size);
+        for (int i = 0 ; i < size ; ++i) {
+            collection.push_back(hasard::engine()());
+        }
+        cppsort::ips2ra_sorter(3)(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "sort few distinct values" )
+    {
+        std::vector<short> collection;
+        collection.reserve(size);
+        auto distribution_16 = dist::shuffled_16_values{};
+        distribution_16(std::back_inserter(collection), size);
+        cppsort::ips2ra_sorter(4)(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "sort floating point numbers" )
+    {
+        std::vector<double> collection;
+        collection.reserve(size);
+        distribution(std::back_inserter(collection), size, -150'000);
+        for (auto& value: collection) {
+            value /= 7.0;
+        }
+        cppsort::ips2ra_sorter(4)(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "sort 8-bit keys" )
+    {
+        // Every bit of the keys is used by the first distribution
+        std::vector<signed char> collection;
+        collection.reserve(size);
+        for (int i = 0 ; i < size ; ++i) {
+            collection.push_back(static_cast<signed char>(i % 256 - 128));
+        }
+        std::shuffle(collection.begin(), collection.end(), hasard::engine());
+        cppsort::ips2ra_sorter(4)(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "sort boolean keys" )
+    {
+        std::vector<std::pair<bool, int>> collection;
+        collection.reserve(size);
+        for (int i = 0 ; i < size ; ++i) {
+            collection.emplace_back(i % 3 == 0, i);
+        }
+        std::shuffle(collection.begin(), collection.end(), hasard::engine());
+        cppsort::ips2ra_sorter(4)(collection, &std::pair<bool, int>::first);
+        CHECK( helpers::is_sorted(collection.begin(), collection.end(),
+                                  std::less<>{}, &std::pair<bool, int>::first) );
+    }
+
+    SECTION( "sort 64-bit keys differing only in their low bits" )
+    {
+        // The distribution skips the common high bits
+        std::vector<std::uint64_t> collection;
+        collection.reserve(size);
+        for (int i = 0 ; i < size ; ++i) {
+            collection.push_back(0xABCD'0000'0000'0000ULL | std::uint64_t(i % 1000));
+        }
+        std::shuffle(collection.begin(), collection.end(), hasard::engine());
+        cppsort::ips2ra_sorter(4)(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "sort 64-bit keys differing in their high and low bits" )
+    {
+        // The first distribution only fills a few buckets, which
+        // are big enough to be distributed again by several threads
+        std::vector<std::uint64_t> collection;
+        collection.reserve(size);
+        for (int i = 0 ; i < size ; ++i) {
+            auto high = std::uint64_t(i % 4) << 60;
+            collection.push_back(high | (hasard::engine()() & 0xFFFF'FFFFULL));
+        }
+        cppsort::ips2ra_sorter(4)(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "sort equal keys" )
+    {
+        std::vector<long> collection(size, std::numeric_limits<long>::min());
+        cppsort::ips2ra_sorter(4)(collection);
+        CHECK( std::all_of(collection.begin(), collection.end(), [](long value) {
+            return value == std::numeric_limits<long>::min();
+        }) );
+    }
+
+    SECTION( "sort negative and positive floats" )
+    {
+        std::vector<float> collection;
+        collection.reserve(size);
+        distribution(std::back_inserter(collection), size, -150'000);
+        for (auto& value: collection) {
+            value *= 1.5f;
+        }
+        cppsort::ips2ra_sorter(4)(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "sort with projections" )
+    {
+        std::vector<std::pair<std::string, long long>> collection;
+        collection.reserve(size);
+        for (int i = 0 ; i < size ; ++i) {
+            collection.emplace_back(std::to_string(i), 1'000'000LL * i - 150'000'000'000LL);
+        }
+        std::shuffle(collection.begin(), collection.end(), hasard::engine());
+        cppsort::ips2ra_sorter(4)(collection, &std::pair<std::string, long long>::second);
+        CHECK( helpers::is_sorted(collection.begin(), collection.end(),
+                                  std::less<>{}, &std::pair<std::string, long long>::second) );
+    }
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/sorters/ips4o_sorter.h>
+#include <testing-tools/algorithm.h>
+#include <testing-tools/distributions.h>
+#include <testing-tools/move_only.h>
+#include <testing-tools/wrapper.h>
+
+TEST_CASE( "ips4o_sorter tests", "[ips4o_sorter]" )
+{
+    const int size = 300'000;
+
+    SECTION( "sort with a comparison" )
+    {
+        std::vector<int> collection;
+        collection.reserve(size);
+        auto distribution = dist::shuffled{};
+        distribution(std::back_inserter(collection), size, -150'000);
+        cppsort::ips4o_sorter sorter(4);
+        sorter(collection, std::greater<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+    }
+
+    SECTION( "sort with a projection and few distinct values" )
+    {
+        using wrapper = generic_wrapper<int>;
+        std::vector<wrapper> collection(size);
+        auto distribution = dist::shuffled_16_values{};
+        distribution(collection.begin(), collection.size());
+        cppsort::ips4o_sorter sorter(3);
+        sorter(collection, &wrapper::value);
+        CHECK( helpers::is_sorted(collection.begin(), collection.end(),
+                                  std::less<>{}, &wrapper::value) );
+    }
+
+    SECTION( "sort non-trivial types" )
+    {
+        std::vector<std::string> collection;
+        collection.reserve(size);
+        for (int i = 0 ; i < size ; ++i) {
+            collection.push_back(std::to_string((i * 7919LL) % size));
+        }
+        cppsort::ips4o_sorter sorter(4);
+        sorter(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "sort move-only types" )
+    {
+        // Elements that can't be copied to make splitters are
+        // sorted with pdqsort instead
+        std::vector<move_only<int>> collection;
+        collection.reserve(size);
+        for (int i = 0 ; i < size ; ++i) {
+            collection.emplace_back(int((i * 7919LL) % size));
+        }
+        cppsort::ips4o_sorter sorter(4);
+        sorter(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "last block of the last bucket past the end" )
+    {
+        // The last bucket only gets full blocks, but doesn't start
+        // on a block boundary: its last block overlaps the end of
+        // the collection and goes through the overflow buffer
+        const int overflow_size = 150'001;
+        std::vector<int> collection;
+        collection.reserve(overflow_size);
+        for (int i = 0 ; i < overflow_size ; ++i) {
+            collection.push_back(i < 16 * 512 ? INT_MAX : int((i * 7919LL) % overflow_size));
+        }
+        auto expected = collection;
+        std::sort(expected.begin(), expected.end());
+
+        cppsort::ips4o_sorter sorter(4);
+        sorter(collection);
+        CHECK( collection == expected );
+    }
+
+    SECTION( "buckets big enough for every thread" )
+    {
+        // Every bucket is sorted by all the threads in turn, and
+        // only holds equivalent elements
+        std::vector<int> collection;
+        collection.reserve(size);
+        for (int i = 0 ; i < size ; ++i) {
+            collection.push_back(int((i * 7919LL) % 3));
+        }
+        auto expected = collection;
+        std::sort(expected.begin(), expected.end());
+
+        cppsort::ips4o_sorter sorter(4);
+        sorter(collection);
+        CHECK( collection == expected );
+    }
+
+    SECTION( "bucket holding most of the elements" )
+    {
+        // Such a bucket is sorted with pdqsort instead of
+        // being distributed again
+        std::vector<int> collection;
+        collection.reserve(size);
+        for (int i = 0 ; i < size ; ++i) {
+            collection.push_back(i % 5 < 3 ? 0 : int((i * 7919LL) % size));
+        }
+        auto expected = collection;
+        std::sort(expected.begin(), expected.end());
+
+        cppsort::ips4o_sorter sorter(4);
+        sorter(collection);
+        CHECK( collection == expected );
+    }
+
+    SECTION( "no element is lost when a comparison throws" )
+    {
+        std::vector<int> collection;
+        collection.reserve(size);
+        auto distribution = dist::shuffled{};
+        distribution(std::back_inserter(collection), size, 0);
+
+        // Throw during the local classification of the first
+        // distribution step, after the sample is sorted
+        std::atomic<int> count(0);
+        auto compare = [&count](int lhs, int rhs) {
+            if (++count == 200'000) {
+                throw std::runtime_error("comparison threw");
+            }
+            return lhs < rhs;
+        };
+        cppsort::ips4o_sorter sorter(4);
+        CHECK_THROWS_AS( sorter(collection, compare), std::runtime_error );
+
+        std::sort(collection.begin(), collection.end());
+        std::vector<int> expected(size);
+        helpers::iota(expected.begin(), expected.end(), 0);
+        CHECK( collection == expected );
+    }
+
+    SECTION( "is_always_stable" )
+    {
+        STATIC_CHECK( not cppsort::is_always_stable_v<cppsort::ips4o_sorter> );
+    }
+}
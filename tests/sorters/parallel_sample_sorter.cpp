@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <cpp-sort/adapters/indirect_adapter.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/parallel_sample_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <testing-tools/algorithm.h>
+#include <testing-tools/distributions.h>
+#include <testing-tools/wrapper.h>
+
+TEST_CASE( "parallel_sample_sorter tests", "[parallel_sample_sorter]" )
+{
+    const int size = 100'000;
+
+    SECTION( "sort with the default bucket sorter" )
+    {
+        std::vector<int> collection;
+        collection.reserve(size);
+        auto distribution = dist::shuffled{};
+        distribution(std::back_inserter(collection), size, -50'000);
+        cppsort::parallel_sample_sorter<> sorter(4);
+        sorter(collection, std::greater<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+    }
+
+    SECTION( "stability with few distinct values" )
+    {
+        using wrapper = generic_stable_wrapper<int>;
+        std::vector<wrapper> collection(size);
+        helpers::iota(collection.begin(), collection.end(), 0, &wrapper::order);
+        auto distribution = dist::shuffled_16_values{};
+        distribution(collection.begin(), collection.size());
+
+        cppsort::parallel_sample_sorter<> sorter(3);
+        sorter(collection, &wrapper::value);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "stability with an unstable bucket sorter" )
+    {
+        // The bucket sorter is wrapped in stable_t
+        using wrapper = generic_stable_wrapper<int>;
+        std::vector<wrapper> collection(size);
+        helpers::iota(collection.begin(), collection.end(), 0, &wrapper::order);
+        auto distribution = dist::descending_plateau{};
+        distribution(collection.begin(), collection.size());
+
+        cppsort::parallel_sample_sorter<cppsort::pdq_sorter> sorter(cppsort::pdq_sorter{}, 4);
+        sorter(collection, &wrapper::value);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "sort non-trivial types" )
+    {
+        std::vector<std::string> collection;
+        collection.reserve(size);
+        for (int i = 0 ; i < size ; ++i) {
+            collection.push_back(std::to_string((i * 7919) % size));
+        }
+        cppsort::parallel_sample_sorter<> sorter(4);
+        sorter(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "throwing comparison while sorting the buckets" )
+    {
+        // Moved-from strings are empty, lost elements are visible
+        std::vector<std::string> collection;
+        collection.reserve(size);
+        for (int i = 0 ; i < size ; ++i) {
+            collection.push_back(std::to_string((i * 7919) % size));
+        }
+        auto expected = collection;
+        std::sort(expected.begin(), expected.end());
+
+        // Classifying the elements takes fewer comparisons
+        std::atomic<int> count(0);
+        auto compare = [&](const std::string& lhs, const std::string& rhs) {
+            if (++count == 1'000'000) {
+                throw std::runtime_error("comparison threw");
+            }
+            return lhs < rhs;
+        };
+        // indirect_adapter only compares while sorting iterators,
+        // so the buckets themselves don't lose elements
+        using bucket_sorter = cppsort::indirect_adapter<cppsort::merge_sorter>;
+        cppsort::parallel_sample_sorter<bucket_sorter> sorter(bucket_sorter{}, 4);
+        CHECK_THROWS_AS( sorter(collection, compare), std::runtime_error );
+
+        // The collection is still a permutation of the original
+        std::sort(collection.begin(), collection.end());
+        CHECK( collection == expected );
+    }
+
+    SECTION( "is_always_stable" )
+    {
+        STATIC_CHECK( cppsort::is_always_stable_v<cppsort::parallel_sample_sorter<>> );
+        STATIC_CHECK( cppsort::is_always_stable_v<cppsort::parallel_sample_sorter<cppsort::pdq_sorter>> );
+    }
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <cpp-sort/sorters/parallel_spread_sorter.h>
+#include <testing-tools/algorithm.h>
+#include <testing-tools/distributions.h>
+#include <testing-tools/random.h>
+
+TEST_CASE( "parallel_spread_sorter tests", "[parallel_spread_sorter]" )
+{
+    const int size = 300'000;
+    auto distribution = dist::shuffled{};
+
+    SECTION( "sort signed integers" )
+    {
+        std::vector<int> collection;
+        collection.reserve(size);
+        distribution(std::back_inserter(collection), size, -150'000);
+        cppsort::parallel_spread_sorter(4)(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "sort unsigned integers with a wide range" )
+    {
+        std::vector<std::uint64_t> collection;
+        collection.reserve(size);
+        for (int i = 0 ; i < size ; ++i) {
+            collection.push_back(hasard::engine()());
+        }
+        cppsort::parallel_spread_sorter(3)(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "sort skewed integers" )
+    {
+        // Most elements fall into a single bin
+        std::vector<long long> collection;
+        collection.reserve(size);
+        distribution(std::back_inserter(collection), size - 1000, 0);
+        for (int i = 0 ; i < 1000 ; ++i) {
+            collection.push_back(1'000'000'000LL * i);
+        }
+        std::shuffle(collection.begin(), collection.end(), hasard::engine());
+        cppsort::parallel_spread_sorter(4)(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "sort floating point numbers" )
+    {
+        std::vector<double> collection;
+        collection.reserve(size);
+        distribution(std::back_inserter(collection), size, -150'000);
+        for (auto& value: collection) {
+            value /= 7.0;
+        }
+        cppsort::parallel_spread_sorter(4)(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "sort with projections" )
+    {
+        std::vector<std::pair<int, float>> collection;
+        for (int i = 0 ; i < size ; ++i) {
+            collection.emplace_back(i, float(i));
+        }
+        std::shuffle(collection.begin(), collection.end(), hasard::engine());
+        cppsort::parallel_spread_sorter(4)(collection, &std::pair<int, float>::second);
+        CHECK( helpers::is_sorted(collection.begin(), collection.end(),
+                                  std::less<>{}, &std::pair<int, float>::first) );
+    }
+
+    SECTION( "sort elements which are not trivially copyable" )
+    {
+        // The elements are swapped into their bins in-place
+        // instead of being scattered to a buffer
+        std::vector<std::pair<int, std::string>> collection;
+        collection.reserve(size);
+        for (int i = 0 ; i < size ; ++i) {
+            collection.emplace_back(i % 50'000, std::to_string(i % 50'000));
+        }
+        std::shuffle(collection.begin(), collection.end(), hasard::engine());
+        cppsort::parallel_spread_sorter(4)(collection, &std::pair<int, std::string>::first);
+        CHECK( helpers::is_sorted(collection.begin(), collection.end(),
+                                  std::less<>{}, &std::pair<int, std::string>::first) );
+        CHECK( std::all_of(collection.begin(), collection.end(), [](const auto& elem) {
+            return elem.second == std::to_string(elem.first);
+        }) );
+    }
+
+    SECTION( "sort few distinct values" )
+    {
+        // Every bin only holds equivalent keys after the
+        // first distribution
+        std::vector<int> collection;
+        collection.reserve(size);
+        distribution(std::back_inserter(collection), size, 0);
+        for (auto& value: collection) {
+            value %= 200;
+        }
+        cppsort::parallel_spread_sorter(4)(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "sort an already sorted collection" )
+    {
+        std::vector<int> collection;
+        collection.reserve(size);
+        for (int i = 0 ; i < size ; ++i) {
+            collection.push_back(i);
+        }
+        cppsort::parallel_spread_sorter(4)(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022 Morwenn
+ * Copyright (c) 2019-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #include <algorithm>
@@ -7,7 +7,9 @@
 #include <vector>
 #include <catch2/catch_test_macros.hpp>
 #include <cpp-sort/sorters/spin_sorter.h>
+#include <testing-tools/algorithm.h>
 #include <testing-tools/distributions.h>
+#include <testing-tools/wrapper.h>
 
 TEST_CASE( "spin_sorter tests", "[spin_sorter]" )
 {
@@ -39,3 +41,20 @@ TEST_CASE( "spin_sorter tests", "[spin_sorter]" )
         CHECK( std::is_sorted(collection.begin(), collection.end()) );
     }
 }
+
+TEST_CASE( "spin_sorter stability with a branchless merge", "[spin_sorter][is_stable]" )
+{
+    // Merging trivially copyable elements with a branchless
+    // comparison and projection uses a merge which fills the
+    // output from both ends at once, which must not break the
+    // stability of the algorithm
+
+    using wrapper = generic_stable_wrapper<int>;
+    std::vector<wrapper> collection(10000);
+    helpers::iota(collection.begin(), collection.end(), 0, &wrapper::order);
+
+    auto distribution = dist::shuffled_16_values{};
+    distribution(collection.begin(), collection.size());
+    cppsort::spin_sort(collection, &wrapper::value);
+    CHECK( std::is_sorted(collection.begin(), collection.end()) );
+}
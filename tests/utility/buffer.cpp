@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2022 Morwenn
+ * Copyright (c) 2015-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #include <catch2/catch_test_macros.hpp>
@@ -41,4 +41,37 @@ TEST_CASE( "miscellaneous tests for buffer providers",
         CHECK( buffer.end() == buffer.cend() );
         CHECK( buffer.end() == buffer.begin() + buffer.size() );
     }
+
+    SECTION( "heap_memory" )
+    {
+        utility::heap_memory memory;
+        void* ptr = memory.allocate(64 * sizeof(int));
+        CHECK( ptr != nullptr );
+        memory.deallocate(ptr, 64 * sizeof(int));
+    }
+
+    SECTION( "thread_local_memory reuses its memory" )
+    {
+        utility::thread_local_memory memory;
+        utility::thread_local_memory::release();
+
+        void* ptr1 = memory.allocate(128);
+        memory.deallocate(ptr1, 128);
+        void* ptr2 = memory.allocate(64);
+        CHECK( ptr1 == ptr2 );
+
+        // The memory is in use: the nested allocation gets
+        // new memory
+        void* ptr3 = memory.allocate(64);
+        CHECK( ptr3 != ptr2 );
+        memory.deallocate(ptr3, 64);
+        memory.deallocate(ptr2, 64);
+
+        // Not in use anymore, can be reused
+        void* ptr4 = memory.allocate(128);
+        CHECK( ptr4 == ptr1 );
+        memory.deallocate(ptr4, 128);
+
+        utility::thread_local_memory::release();
+    }
 }
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/sorters/ska_sorter.h>
+#include <cpp-sort/utility/co_sort.h>
+#include <testing-tools/distributions.h>
+
+TEST_CASE( "co_sort", "[utility][co_sort]" )
+{
+    std::vector<int> keys;
+    auto distribution = dist::shuffled_16_values{};
+    distribution(std::back_inserter(keys), 1000);
+
+    // Columns whose elements are derived from their key and
+    // their original position
+    std::vector<int> positions(keys.size());
+    std::vector<std::string> strings;
+    std::vector<std::unique_ptr<int>> pointers;
+    for (std::size_t idx = 0; idx < keys.size(); ++idx) {
+        positions[idx] = static_cast<int>(idx);
+        strings.push_back(std::to_string(keys[idx]));
+        pointers.push_back(std::make_unique<int>(keys[idx]));
+    }
+    auto original_keys = keys;
+
+    auto check_columns = [&] {
+        bool consistent = true;
+        for (std::size_t idx = 0; idx < keys.size(); ++idx) {
+            consistent = consistent
+                && original_keys[positions[idx]] == keys[idx]
+                && strings[idx] == std::to_string(keys[idx])
+                && *pointers[idx] == keys[idx];
+        }
+        CHECK( consistent );
+    };
+
+    SECTION( "comparison sorter" )
+    {
+        cppsort::utility::co_sort<cppsort::merge_sorter>{}(keys, positions, strings, pointers);
+        CHECK( std::is_sorted(keys.begin(), keys.end()) );
+        check_columns();
+        // merge_sorter is stable
+        bool stable = true;
+        for (std::size_t idx = 1; idx < keys.size(); ++idx) {
+            if (keys[idx - 1] == keys[idx]) {
+                stable = stable && positions[idx - 1] < positions[idx];
+            }
+        }
+        CHECK( stable );
+    }
+
+    SECTION( "radix sorter" )
+    {
+        cppsort::utility::co_sort<cppsort::ska_sorter>{}(keys, positions, strings, pointers);
+        CHECK( std::is_sorted(keys.begin(), keys.end()) );
+        check_columns();
+    }
+
+    SECTION( "comparison and projection" )
+    {
+        cppsort::utility::co_sort<cppsort::pdq_sorter> sorter;
+        sorter(keys, positions, strings, pointers, std::greater<>{});
+        CHECK( std::is_sorted(keys.begin(), keys.end(), std::greater<>{}) );
+        check_columns();
+
+        sorter(keys, positions, strings, pointers, std::less<>{}, std::negate<>{});
+        CHECK( std::is_sorted(keys.begin(), keys.end(), std::greater<>{}) );
+        check_columns();
+    }
+
+    SECTION( "keys only" )
+    {
+        cppsort::utility::co_sort<cppsort::pdq_sorter>{}(keys);
+        CHECK( std::is_sorted(keys.begin(), keys.end()) );
+    }
+
+    SECTION( "arrays" )
+    {
+        int array_keys[] = { 3, 1, 2, 0 };
+        double array_column[] = { 3.0, 1.0, 2.0, 0.0 };
+        cppsort::utility::co_sort<cppsort::pdq_sorter>{}(array_keys, array_column);
+        CHECK( std::is_sorted(std::begin(array_keys), std::end(array_keys)) );
+        CHECK( std::is_sorted(std::begin(array_column), std::end(array_column)) );
+    }
+}
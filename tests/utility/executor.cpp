@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <cpp-sort/probes/dis.h>
+#include <cpp-sort/probes/parallel_dis.h>
+#include <cpp-sort/sorters/ips4o_sorter.h>
+#include <cpp-sort/sorters/parallel_sample_sorter.h>
+#include <cpp-sort/utility/executor.h>
+#include <testing-tools/distributions.h>
+
+namespace
+{
+    // Runs the tasks in the order they were submitted when
+    // asked to, and counts them
+    struct deferred_executor
+    {
+        std::vector<std::function<void()>> tasks;
+        std::size_t nb_submitted = 0;
+
+        auto submit(std::function<void()> task)
+            -> void
+        {
+            tasks.push_back(std::move(task));
+            ++nb_submitted;
+        }
+
+        auto parallelism() const
+            -> std::size_t
+        {
+            return 4;
+        }
+
+        auto run_all()
+            -> void
+        {
+            for (auto& task: tasks) {
+                task();
+            }
+            tasks.clear();
+        }
+    };
+}
+
+TEST_CASE( "executors and fork_join", "[utility][executor]" )
+{
+    using namespace cppsort;
+
+    STATIC_CHECK( utility::is_executor_v<utility::thread_pool> );
+    STATIC_CHECK( utility::is_executor_v<utility::executor_ref> );
+    STATIC_CHECK( utility::is_executor_v<deferred_executor> );
+    STATIC_CHECK( not utility::is_executor_v<std::vector<int>> );
+
+    SECTION( "thread_pool runs every task" )
+    {
+        std::atomic<int> count(0);
+        {
+            utility::thread_pool pool(3);
+            CHECK( pool.parallelism() == 3 );
+            for (int idx = 0; idx < 100; ++idx) {
+                pool.submit([&count] { ++count; });
+            }
+        }
+        CHECK( count == 100 );
+    }
+
+    SECTION( "fork_join calls func for every index" )
+    {
+        utility::thread_pool pool(2);
+        std::vector<int> calls(50, 0);
+        utility::fork_join(pool, calls.size(), [&](std::size_t idx) {
+            ++calls[idx];
+        });
+        CHECK( std::all_of(calls.begin(), calls.end(), [](int n) { return n == 1; }) );
+    }
+
+    SECTION( "nested fork_join" )
+    {
+        utility::thread_pool pool(2);
+        std::vector<int> calls(64, 0);
+        utility::fork_join(pool, 8, [&](std::size_t outer) {
+            utility::fork_join(pool, 8, [&](std::size_t inner) {
+                ++calls[outer * 8 + inner];
+            });
+        });
+        CHECK( std::all_of(calls.begin(), calls.end(), [](int n) { return n == 1; }) );
+    }
+
+    SECTION( "fork_join rethrows exceptions" )
+    {
+        utility::thread_pool pool(2);
+        std::atomic<int> count(0);
+        CHECK_THROWS_AS(
+            utility::fork_join(pool, 10, [&](std::size_t idx) {
+                ++count;
+                if (idx == 3) {
+                    throw std::runtime_error("task 3");
+                }
+            }),
+            std::runtime_error
+        );
+        CHECK( count == 10 );
+    }
+
+    SECTION( "fork_join doesn't wait for the executor" )
+    {
+        deferred_executor executor;
+        std::vector<int> calls(6, 0);
+        utility::fork_join(executor, calls.size(), [&](std::size_t idx) {
+            ++calls[idx];
+        });
+        CHECK( executor.nb_submitted == 5 );
+        CHECK( std::all_of(calls.begin(), calls.end(), [](int n) { return n == 1; }) );
+        // The jobs find no task left to run
+        executor.run_all();
+        CHECK( std::all_of(calls.begin(), calls.end(), [](int n) { return n == 1; }) );
+    }
+}
+
+TEST_CASE( "parallel sorters with an executor", "[utility][executor]" )
+{
+    using namespace cppsort;
+
+    std::vector<int> collection;
+    collection.reserve(200'000);
+    auto distribution = dist::shuffled{};
+    distribution(std::back_inserter(collection), 200'000);
+
+    SECTION( "ips4o_sorter" )
+    {
+        deferred_executor executor;
+        ips4o_sorter sorter(executor, 2);
+        sorter(collection, std::greater<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+        CHECK( executor.nb_submitted > 0 );
+        executor.run_all();
+    }
+
+    SECTION( "parallel_sample_sorter" )
+    {
+        utility::thread_pool pool(2);
+        parallel_sample_sorter<> sorter(pool);
+        sorter(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "probe::parallel_dis" )
+    {
+        deferred_executor executor;
+        auto dis = probe::dis(collection);
+        CHECK( probe::parallel_dis(executor)(collection) == dis );
+        CHECK( executor.nb_submitted > 0 );
+        executor.run_all();
+    }
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <cpp-sort/utility/resumable_sort.h>
+#include <testing-tools/algorithm.h>
+#include <testing-tools/distributions.h>
+#include <testing-tools/wrapper.h>
+
+TEST_CASE( "resumable_sort", "[utility][resumable_sort]" )
+{
+    using namespace cppsort;
+
+    std::vector<int> collection;
+    collection.reserve(10'000);
+    auto distribution = dist::shuffled{};
+    distribution(std::back_inserter(collection), 10'000);
+
+    SECTION( "bounded steps" )
+    {
+        auto sort = utility::make_resumable_sort(collection, std::greater<>{});
+        CHECK( not sort.done() );
+        double progress = sort.progress();
+        while (not sort.resume(100)) {
+            CHECK( sort.progress() >= progress );
+            progress = sort.progress();
+        }
+        CHECK( sort.done() );
+        CHECK( sort.progress() == 1.0 );
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+    }
+
+    SECTION( "time budget" )
+    {
+        auto sort = utility::make_resumable_sort(collection.begin(), collection.end());
+        while (not sort.resume_for(std::chrono::microseconds(50))) {}
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "finish" )
+    {
+        auto sort = utility::make_resumable_sort(collection);
+        sort.resume(1);
+        sort.finish();
+        CHECK( sort.done() );
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "stability" )
+    {
+        using wrapper = generic_stable_wrapper<int>;
+        std::vector<wrapper> wrappers(10'000);
+        helpers::iota(wrappers.begin(), wrappers.end(), 0, &wrapper::order);
+        auto values = dist::shuffled_16_values{};
+        values(wrappers.begin(), wrappers.size());
+
+        auto sort = utility::make_resumable_sort(wrappers, std::less<>{}, &wrapper::value);
+        while (not sort.resume(37)) {}
+        CHECK( std::is_sorted(wrappers.begin(), wrappers.end()) );
+    }
+
+    SECTION( "small collections" )
+    {
+        std::vector<int> empty;
+        CHECK( utility::make_resumable_sort(empty).resume(1) );
+        std::vector<int> small = { 5, 8, 3, 2, 9, 1, 0, 4, 7, 6 };
+        auto sort = utility::make_resumable_sort(small);
+        sort.finish();
+        CHECK( std::is_sorted(small.begin(), small.end()) );
+    }
+
+    SECTION( "abandoned sort" )
+    {
+        std::vector<int> expected(collection.size());
+        helpers::iota(expected.begin(), expected.end(), 0);
+
+        // Stop in the middle of merges, the last one merging
+        // its runs from the back
+        for (std::size_t nb_steps: { 10'500, 52'000, 95'000 }) {
+            auto copy = collection;
+            {
+                auto sort = utility::make_resumable_sort(copy);
+                sort.resume(nb_steps);
+                CHECK( not sort.done() );
+            }
+            std::sort(copy.begin(), copy.end());
+            CHECK( copy == expected );
+        }
+    }
+
+    SECTION( "throwing comparison" )
+    {
+        std::vector<int> expected(collection.size());
+        helpers::iota(expected.begin(), expected.end(), 0);
+
+        // The comparison only throws once the blocks are sorted:
+        // 10'000 elements take 9 merge passes after the blocks
+        // phase, which is the first tenth of the progress
+        int count = 0;
+        bool merging = false;
+        bool fail = true;
+        auto compare = [&](int lhs, int rhs) {
+            if (fail && merging && ++count % 1'000 == 0) {
+                throw std::runtime_error("comparison threw");
+            }
+            return lhs < rhs;
+        };
+
+        // Part of the collection lives in the buffer during a
+        // merge, so the interrupted merges are simply resumed
+        auto sort = utility::make_resumable_sort(collection, compare);
+        int nb_throws = 0;
+        while (nb_throws < 50 && not sort.done()) {
+            try {
+                sort.resume(250);
+            } catch (const std::runtime_error&) {
+                ++nb_throws;
+                CHECK( sort.progress() > 0.1 );
+                CHECK( not sort.done() );
+            }
+            merging = sort.progress() > 0.1;
+        }
+        fail = false;
+        sort.finish();
+        CHECK( nb_throws == 50 );
+        // No element was lost or duplicated by the interrupted merges
+        CHECK( collection == expected );
+    }
+}
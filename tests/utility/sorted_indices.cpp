@@ -1,13 +1,23 @@
 /*
- * Copyright (c) 2022 Morwenn
+ * Copyright (c) 2022-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iterator>
+#include <numeric>
+#include <string>
+#include <type_traits>
 #include <vector>
 #include <catch2/catch_test_macros.hpp>
 #include <cpp-sort/sorters/heap_sorter.h>
 #include <cpp-sort/sorters/insertion_sorter.h>
+#include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/ska_sorter.h>
+#include <cpp-sort/sorters/spread_sorter.h>
+#include <cpp-sort/utility/apply_permutation.h>
 #include <cpp-sort/utility/sorted_indices.h>
 #include <testing-tools/distributions.h>
 
@@ -70,3 +80,65 @@ TEST_CASE( "basic sorted_indices test", "[utility][sorted_indices]" )
         CHECK( indices == expected );
     }
 }
+
+TEST_CASE( "sorted_indices with custom index types and destinations",
+           "[utility][sorted_indices]" )
+{
+    std::vector<double> vec;
+    auto distribution = dist::shuffled_16_values{};
+    distribution(std::back_inserter(vec), 1000);
+
+    // Expected indices computed without key gathering
+    std::vector<std::ptrdiff_t> expected(vec.size());
+    std::iota(expected.begin(), expected.end(), 0);
+    std::stable_sort(expected.begin(), expected.end(), [&](auto lhs, auto rhs) {
+        return vec[lhs] < vec[rhs];
+    });
+
+    SECTION( "narrow index type" )
+    {
+        auto get_sorted_indices_for = cppsort::utility::sorted_indices<
+            cppsort::merge_sorter, std::uint32_t
+        >{};
+        auto indices = get_sorted_indices_for(vec);
+        STATIC_CHECK( std::is_same<decltype(indices), std::vector<std::uint32_t>>::value );
+        CHECK( std::equal(indices.begin(), indices.end(), expected.begin(), expected.end()) );
+    }
+
+    SECTION( "caller-provided destination" )
+    {
+        auto get_sorted_indices_for = cppsort::utility::sorted_indices<cppsort::merge_sorter>{};
+        std::vector<std::uint16_t> indices(vec.size());
+        auto last = get_sorted_indices_for.into(vec, indices.begin());
+        CHECK( last == indices.end() );
+        CHECK( std::equal(indices.begin(), indices.end(), expected.begin(), expected.end()) );
+
+        std::uint32_t array[1000];
+        get_sorted_indices_for.into(vec.begin(), vec.end(), array, std::greater<>{});
+        CHECK( std::is_sorted(std::begin(array), std::end(array), [&](auto lhs, auto rhs) {
+            return vec[lhs] > vec[rhs];
+        }) );
+    }
+
+    SECTION( "radix sorters" )
+    {
+        auto by_spread_sort = cppsort::utility::sorted_indices<cppsort::spread_sorter, std::uint32_t>{};
+        auto indices = by_spread_sort(vec);
+        CHECK( std::is_sorted(indices.begin(), indices.end(), [&](auto lhs, auto rhs) {
+            return vec[lhs] < vec[rhs];
+        }) );
+
+        auto by_ska_sort = cppsort::utility::sorted_indices<cppsort::ska_sorter>{};
+        auto sorted = vec;
+        cppsort::utility::apply_permutation(sorted, by_ska_sort(vec));
+        CHECK( std::is_sorted(sorted.begin(), sorted.end()) );
+    }
+
+    SECTION( "non-arithmetic keys" )
+    {
+        std::vector<std::string> strings = { "e", "b", "d", "a", "c" };
+        auto get_sorted_indices_for = cppsort::utility::sorted_indices<cppsort::merge_sorter, int>{};
+        auto indices = get_sorted_indices_for(strings);
+        CHECK( indices == std::vector<int>{ 3, 1, 4, 2, 0 } );
+    }
+}
@@ -1,17 +1,67 @@
 /*
- * Copyright (c) 2022 Morwenn
+ * Copyright (c) 2022-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
 #include <iterator>
+#include <list>
+#include <string>
+#include <type_traits>
 #include <vector>
 #include <catch2/catch_test_macros.hpp>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
 #include <cpp-sort/sorters/heap_sorter.h>
 #include <cpp-sort/sorters/insertion_sorter.h>
+#include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/sorters/ska_sorter.h>
+#include <cpp-sort/utility/executor.h>
 #include <cpp-sort/utility/functional.h>
 #include <cpp-sort/utility/sorted_iterators.h>
 #include <testing-tools/algorithm.h>
 #include <testing-tools/distributions.h>
 
+namespace
+{
+    // Stable sorter counting how many times it sorted a chunk
+    // of the collection to completion
+    struct counting_sorter_impl
+    {
+        std::atomic<int>* nb_calls = nullptr;
+
+        template<
+            typename RandomAccessIterator,
+            typename Compare = std::less<>,
+            typename Projection = cppsort::utility::identity,
+            typename = std::enable_if_t<cppsort::is_projection_iterator_v<
+                Projection, RandomAccessIterator, Compare
+            >>
+        >
+        auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                        Compare compare={}, Projection projection={}) const
+            -> void
+        {
+            cppsort::merge_sort(first, last, compare, projection);
+            ++*nb_calls;
+        }
+
+        using iterator_category = std::random_access_iterator_tag;
+        using is_always_stable = std::true_type;
+    };
+
+    struct counting_sorter:
+        cppsort::sorter_facade<counting_sorter_impl>
+    {
+        explicit counting_sorter(std::atomic<int>& nb_calls):
+            cppsort::sorter_facade<counting_sorter_impl>(counting_sorter_impl{ &nb_calls })
+        {}
+    };
+}
+
 TEST_CASE( "basic sorted_iterators test", "[utility][sorted_iterators]" )
 {
     using cppsort::utility::indirect;
@@ -99,3 +149,80 @@ TEST_CASE( "basic sorted_iterators test", "[utility][sorted_iterators]" )
         CHECK( indices == expected );
     }
 }
+
+TEST_CASE( "sorted_iterators with executors and destinations",
+           "[utility][sorted_iterators]" )
+{
+    using cppsort::utility::indirect;
+
+    std::list<int> li;
+    auto distribution = dist::shuffled_16_values{};
+    distribution(std::back_inserter(li), 100'000);
+
+    SECTION( "executor" )
+    {
+        cppsort::utility::thread_pool pool(2);
+        auto get_sorted_iterators_for = cppsort::utility::sorted_iterators<cppsort::pdq_sorter>(
+            cppsort::pdq_sorter{}, pool, 4
+        );
+        auto iterators = get_sorted_iterators_for(li, std::greater<>{});
+        CHECK( iterators.size() == li.size() );
+        CHECK( helpers::is_sorted(iterators.begin(), iterators.end(), std::greater<>{}, indirect{}) );
+    }
+
+    SECTION( "chunks sorted in parallel then merged" )
+    {
+        std::vector<int> vec(li.begin(), li.end());
+        std::atomic<int> nb_calls(0);
+        cppsort::utility::thread_pool pool(2);
+        auto get_sorted_iterators_for = cppsort::utility::sorted_iterators<counting_sorter>(
+            counting_sorter(nb_calls), pool, 4
+        );
+        auto iterators = get_sorted_iterators_for(vec);
+        // Every chunk is sorted by its own call to the sorter
+        CHECK( nb_calls == 4 );
+        CHECK( helpers::is_sorted(iterators.begin(), iterators.end(), {}, indirect{}) );
+
+        // The merge keeps equivalent elements in their original order
+        bool stable = true;
+        for (std::size_t idx = 1; idx < iterators.size(); ++idx) {
+            if (*iterators[idx - 1] == *iterators[idx]) {
+                stable = stable && iterators[idx - 1] < iterators[idx];
+            }
+        }
+        CHECK( stable );
+    }
+
+    SECTION( "reused destination" )
+    {
+        auto get_sorted_iterators_for = cppsort::utility::sorted_iterators<cppsort::ska_sorter>{};
+        std::vector<std::list<int>::iterator> iterators(li.size());
+        for (int idx = 0; idx < 2; ++idx) {
+            auto last = get_sorted_iterators_for.into(li, iterators.begin());
+            CHECK( last == iterators.end() );
+            CHECK( helpers::is_sorted(iterators.begin(), iterators.end(), {}, indirect{}) );
+        }
+    }
+
+    SECTION( "same result with and without key gathering" )
+    {
+        std::vector<int> vec(li.begin(), li.end());
+        std::vector<std::string> strings;
+        for (int value: vec) {
+            strings.push_back(std::to_string(100 + value));
+        }
+
+        // Arithmetic keys are gathered, strings aren't: both have
+        // the same order and merge_sorter is stable
+        auto get_sorted_iterators_for = cppsort::utility::sorted_iterators<cppsort::merge_sorter>(
+            cppsort::merge_sorter{}, cppsort::utility::executor_ref{}, 3
+        );
+        auto vec_iterators = get_sorted_iterators_for(vec);
+        auto str_iterators = get_sorted_iterators_for(strings);
+        REQUIRE( vec_iterators.size() == str_iterators.size() );
+        CHECK( std::equal(vec_iterators.begin(), vec_iterators.end(), str_iterators.begin(),
+                          [&](auto lhs, auto rhs) {
+                              return lhs - vec.begin() == rhs - strings.begin();
+                          }) );
+    }
+}
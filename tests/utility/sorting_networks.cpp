@@ -1,10 +1,13 @@
 /*
- * Copyright (c) 2021-2022 Morwenn
+ * Copyright (c) 2021-2023 Morwenn
  * SPDX-License-Identifier: MIT
  */
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <iterator>
 #include <numeric>
+#include <utility>
 #include <vector>
 #include <catch2/catch_test_macros.hpp>
 #include <cpp-sort/fixed/sorting_network_sorter.h>
@@ -63,3 +66,173 @@ TEST_CASE( "sorting with index pairs from sorting_network_sorter",
         CHECK( std::is_sorted(vec.begin(), vec.end()) );
     }
 }
+
+TEST_CASE( "generated sorting_network_sorter networks",
+           "[utility][sorting_networks][sorting_network_sorter]" )
+{
+    std::vector<int> collection;
+    collection.reserve(200);
+    auto distribution = dist::shuffled{};
+    distribution(std::back_inserter(collection), 200);
+
+    SECTION( "size 65" )
+    {
+        std::vector<int> vec(collection.begin(), collection.begin() + 65);
+        cppsort::sorting_network_sorter<65>{}(vec);
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+    }
+
+    SECTION( "size 100" )
+    {
+        std::vector<int> vec(collection.begin(), collection.begin() + 100);
+        cppsort::sorting_network_sorter<100>{}(vec);
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+    }
+
+    SECTION( "size 200" )
+    {
+        cppsort::sorting_network_sorter<200>{}(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+}
+
+TEST_CASE( "sorting network metrics", "[utility][sorting_networks]" )
+{
+    constexpr auto pairs8 = cppsort::sorting_network_sorter<8>::index_pairs<int>();
+    STATIC_CHECK( cppsort::utility::network_size(pairs8) == 19 );
+    STATIC_CHECK( cppsort::utility::network_depth<8>(pairs8) == 6 );
+
+    constexpr auto pairs0 = cppsort::sorting_network_sorter<0>::index_pairs<int>();
+    STATIC_CHECK( cppsort::utility::network_size(pairs0) == 0 );
+    STATIC_CHECK( cppsort::utility::network_depth<0>(pairs0) == 0 );
+
+    // Two best-known 64-input networks merged with 385 CEs
+    constexpr auto pairs128 = cppsort::sorting_network_sorter<128>::index_pairs<int>();
+    STATIC_CHECK( cppsort::utility::network_size(pairs128) == 2 * 521 + 385 );
+}
+
+namespace
+{
+    template<std::size_t N>
+    auto index_pairs_are_layered()
+        -> bool
+    {
+        constexpr auto pairs = cppsort::sorting_network_sorter<N>::template index_pairs<int>();
+        constexpr auto layers = cppsort::utility::network_layers<N>(pairs);
+        return std::is_sorted(layers.begin(), layers.end());
+    }
+
+    template<std::size_t... Sizes>
+    auto all_index_pairs_are_layered(std::index_sequence<Sizes...>)
+        -> bool
+    {
+        bool results[] = { index_pairs_are_layered<Sizes>()... };
+        return std::all_of(std::begin(results), std::end(results), [](bool res) { return res; });
+    }
+}
+
+TEST_CASE( "sorting network layers", "[utility][sorting_networks]" )
+{
+    SECTION( "layers of a network" )
+    {
+        constexpr auto pairs = cppsort::sorting_network_sorter<8>::index_pairs<int>();
+        constexpr auto layers = cppsort::utility::network_layers<8>(pairs);
+        constexpr std::array<std::size_t, 19> expected = {{
+            0, 0, 0, 0,
+            1, 1, 1, 1,
+            2, 2, 2, 2,
+            3, 3,
+            4, 4,
+            5, 5, 5,
+        }};
+        CHECK( layers == expected );
+    }
+
+    SECTION( "layered_index_pairs" )
+    {
+        // Network for 8 inputs where a CE of the second layer
+        // is performed before a CE of the first one
+        constexpr std::array<cppsort::utility::index_pair<int>, 19> pairs = {{
+            {0, 2}, {1, 3}, {4, 6}, {0, 4}, {5, 7},
+            {1, 5}, {2, 6}, {3, 7},
+            {0, 1}, {2, 3}, {4, 5}, {6, 7},
+            {2, 4}, {3, 5},
+            {1, 4}, {3, 6},
+            {1, 2}, {3, 4}, {5, 6},
+        }};
+        constexpr auto layered = cppsort::utility::layered_index_pairs<8>(pairs);
+        constexpr auto layers = cppsort::utility::network_layers<8>(layered);
+        CHECK( std::is_sorted(layers.begin(), layers.end()) );
+        CHECK( cppsort::utility::network_depth<8>(layered) == cppsort::utility::network_depth<8>(pairs) );
+
+        std::vector<int> vec;
+        auto distribution = dist::shuffled{};
+        distribution(std::back_inserter(vec), 8);
+        cppsort::utility::swap_index_pairs(vec.begin(), layered);
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+    }
+
+    SECTION( "sorting_network_sorter index pairs are ordered by layer" )
+    {
+        CHECK( all_index_pairs_are_layered(std::make_index_sequence<65>{}) );
+        CHECK( index_pairs_are_layered<100>() );
+        CHECK( index_pairs_are_layered<256>() );
+    }
+}
+
+namespace
+{
+    struct small_record
+    {
+        signed char key;
+        signed char tags[2];
+    };
+
+    struct record
+    {
+        int key;
+        int payload[5];
+    };
+}
+
+TEST_CASE( "sorting networks with small trivially copyable records",
+           "[utility][sorting_networks][sorting_network_sorter]" )
+{
+    // Such records are swapped without branches when sorted
+    // on an arithmetic member with a standard comparison
+
+    std::vector<int> keys;
+    auto distribution = dist::shuffled{};
+    distribution(std::back_inserter(keys), 20);
+
+    SECTION( "records of 24 bytes" )
+    {
+        std::vector<record> vec;
+        for (int key: keys) {
+            vec.push_back({ key, { key, key + 1, key + 2, key + 3, key + 4 } });
+        }
+        cppsort::sorting_network_sorter<20>{}(vec, std::greater<>{}, &record::key);
+        CHECK( std::is_sorted(vec.begin(), vec.end(), [](const record& lhs, const record& rhs) {
+            return lhs.key > rhs.key;
+        }) );
+        CHECK( std::all_of(vec.begin(), vec.end(), [](const record& rec) {
+            return rec.payload[0] == rec.key && rec.payload[4] == rec.key + 4;
+        }) );
+    }
+
+    SECTION( "records with an odd size" )
+    {
+        std::vector<small_record> vec;
+        for (int key: keys) {
+            auto small_key = static_cast<signed char>(key);
+            vec.push_back({ small_key, { small_key, small_key } });
+        }
+        cppsort::sorting_network_sorter<20>{}(vec, std::less<>{}, &small_record::key);
+        CHECK( std::is_sorted(vec.begin(), vec.end(), [](const small_record& lhs, const small_record& rhs) {
+            return lhs.key < rhs.key;
+        }) );
+        CHECK( std::all_of(vec.begin(), vec.end(), [](const small_record& rec) {
+            return rec.tags[0] == rec.key && rec.tags[1] == rec.key;
+        }) );
+    }
+}
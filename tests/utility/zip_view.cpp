@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2023 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/sorters/ska_sorter.h>
+#include <cpp-sort/sorters/spin_sorter.h>
+#include <cpp-sort/utility/branchless_traits.h>
+#include <cpp-sort/utility/zip_view.h>
+#include <testing-tools/distributions.h>
+
+TEST_CASE( "zip_view", "[utility][zip_view]" )
+{
+    std::vector<int> keys;
+    auto distribution = dist::shuffled_16_values{};
+    distribution(std::back_inserter(keys), 1000);
+
+    // Columns whose elements are derived from their key and
+    // their original position
+    std::vector<int> positions(keys.size());
+    std::vector<std::string> strings;
+    for (std::size_t idx = 0; idx < keys.size(); ++idx) {
+        positions[idx] = static_cast<int>(idx);
+        strings.push_back(std::to_string(keys[idx]));
+    }
+    auto original_keys = keys;
+
+    auto check_columns = [&] {
+        bool consistent = true;
+        for (std::size_t idx = 0; idx < keys.size(); ++idx) {
+            consistent = consistent
+                && original_keys[positions[idx]] == keys[idx]
+                && strings[idx] == std::to_string(keys[idx]);
+        }
+        CHECK( consistent );
+    };
+
+    auto key = [](const auto& elem) -> decltype(auto) { return std::get<0>(elem); };
+    auto view = cppsort::utility::zip(keys, positions, strings);
+
+    SECTION( "iterator operations" )
+    {
+        auto first = view.begin();
+        auto last = view.end();
+        CHECK( last - first == static_cast<std::ptrdiff_t>(keys.size()) );
+        CHECK( view.size() == keys.size() );
+        CHECK( std::get<1>(first[42]) == 42 );
+        CHECK( std::get<1>(*(last - 1)) == static_cast<int>(keys.size() - 1) );
+
+        iter_swap(first, first + 1);
+        CHECK( positions[0] == 1 );
+        CHECK( positions[1] == 0 );
+        CHECK( strings[0] == std::to_string(original_keys[1]) );
+
+        auto value = iter_move(first);
+        *first = std::move(first[1]);
+        first[1] = std::move(value);
+        CHECK( positions[0] == 0 );
+        CHECK( positions[1] == 1 );
+        check_columns();
+    }
+
+    SECTION( "pdq_sorter" )
+    {
+        cppsort::pdq_sorter{}(view, key);
+        CHECK( std::is_sorted(keys.begin(), keys.end()) );
+        check_columns();
+    }
+
+    SECTION( "merge_sorter" )
+    {
+        cppsort::merge_sorter{}(view, key);
+        CHECK( std::is_sorted(keys.begin(), keys.end()) );
+        check_columns();
+        // merge_sorter is stable
+        bool stable = true;
+        for (std::size_t idx = 1; idx < keys.size(); ++idx) {
+            if (keys[idx - 1] == keys[idx]) {
+                stable = stable && positions[idx - 1] < positions[idx];
+            }
+        }
+        CHECK( stable );
+    }
+
+    SECTION( "ska_sorter" )
+    {
+        cppsort::ska_sorter{}(view, key);
+        CHECK( std::is_sorted(keys.begin(), keys.end()) );
+        check_columns();
+    }
+
+    SECTION( "spin_sorter" )
+    {
+        // Mostly reverse-sorted input, reversed in place by spinsort
+        cppsort::pdq_sorter{}(view.begin(), view.end() - 10, std::greater<>{}, key);
+        cppsort::spin_sorter{}(view, key);
+        CHECK( std::is_sorted(keys.begin(), keys.end()) );
+        check_columns();
+    }
+
+    SECTION( "get_column" )
+    {
+        using reference = decltype(*view.begin());
+        STATIC_CHECK( cppsort::utility::is_probably_branchless_projection_v<
+            cppsort::utility::get_column<0>, reference
+        > );
+        STATIC_CHECK( std::is_same<
+            decltype(cppsort::utility::get_column<2>{}(*view.begin())),
+            std::string&
+        >::value );
+
+        cppsort::pdq_sorter{}(view, std::greater<>{}, cppsort::utility::get_column<0>{});
+        CHECK( std::is_sorted(keys.begin(), keys.end(), std::greater<>{}) );
+        check_columns();
+    }
+
+    SECTION( "lexicographic comparison" )
+    {
+        // Equal keys are ordered by original position
+        cppsort::pdq_sorter{}(view);
+        CHECK( std::is_sorted(view.begin(), view.end()) );
+        CHECK( std::is_sorted(keys.begin(), keys.end()) );
+        check_columns();
+    }
+}